@@ -0,0 +1,71 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include "sockets/basic_socket.h"
+#include "bench_common.h"
+
+using namespace impact;
+
+
+int main(int argc, char** argv) {
+    auto connections = bench::option(argc, argv, "connections", 10000);
+    auto clients     = bench::option(argc, argv, "clients", 4);
+
+    auto server = make_tcp_socket();
+    server.reuse_address(true);
+    server.bind("127.0.0.1", 0);
+    server.listen(512);
+    auto port = server.local_port();
+
+    bench::samples connects;
+    connects.reserve(connections);
+    std::thread acceptor([&]() {
+        /* wait for the client's FIN so TIME_WAIT stays on the client
+           side; server-side TIME_WAIT collides with reused ports and
+           shows up as one-second SYN retransmits */
+        char byte;
+        for (std::uint64_t i = 0; i < connections; i++) {
+            auto peer = server.accept();
+            peer.recv(&byte, 1);
+            peer.close();
+        }
+    });
+
+    /* each client connects and hangs up in turn */
+    std::vector<bench::samples> per_client(clients);
+    std::vector<std::thread> workers;
+    auto start = bench::clock::now();
+    for (std::uint64_t c = 0; c < clients; c++) {
+        auto share = connections / clients +
+            (c < connections % clients ? 1 : 0);
+        workers.emplace_back([&, c, share]() {
+            for (std::uint64_t i = 0; i < share; i++) {
+                auto socket = make_tcp_socket();
+                auto begin  = bench::clock::now();
+                socket.connect(port, "127.0.0.1");
+                per_client[c].add(bench::elapsed_ns(begin));
+                socket.close();
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    acceptor.join();
+    auto seconds = bench::elapsed_ns(start) / 1e9;
+    server.close();
+
+    for (const auto& client : per_client)
+        connects.merge(client);
+
+    bench::report("accept_rate")
+        .field("connections", connections)
+        .field("clients", clients)
+        .field("accepts_per_second", connections / seconds)
+        .latency("connect", connects)
+        .print();
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_BENCH_COMMON_H_
+#define _IMPACT_BENCH_COMMON_H_
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace impact {
+namespace bench {
+    typedef std::chrono::steady_clock clock;
+
+
+    inline std::uint64_t
+    elapsed_ns(clock::time_point __start)
+    {
+        return (std::uint64_t)std::chrono::duration_cast<
+            std::chrono::nanoseconds>(clock::now() - __start).count();
+    }
+
+
+    /* reads --name=value from the command line */
+    inline std::uint64_t
+    option(
+        int           __argc,
+        char**        __argv,
+        const char*   __name,
+        std::uint64_t __fallback)
+    {
+        std::string prefix = std::string("--") + __name + "=";
+        for (int i = 1; i < __argc; i++) {
+            if (std::strncmp(__argv[i], prefix.c_str(), prefix.size()) == 0)
+                return std::strtoull(__argv[i] + prefix.size(), NULL, 10);
+        }
+        return __fallback;
+    }
+
+
+    /* exact latency distribution; benchmarks keep every sample */
+    class samples {
+    public:
+        void reserve(size_t __count) { m_values_.reserve(__count); }
+        size_t size() const { return m_values_.size(); }
+
+        void
+        add(std::uint64_t __ns)
+        {
+            m_values_.push_back(__ns);
+            m_sorted_ = false;
+        }
+
+        void
+        merge(const samples& __other)
+        {
+            m_values_.insert(m_values_.end(),
+                __other.m_values_.begin(), __other.m_values_.end());
+            m_sorted_ = false;
+        }
+
+        std::uint64_t
+        percentile(double __fraction)
+        {
+            if (m_values_.empty()) return 0;
+            _M_sort();
+            auto index = (size_t)(__fraction * (double)(m_values_.size() - 1));
+            return m_values_[index];
+        }
+
+        double
+        mean() const
+        {
+            if (m_values_.empty()) return 0;
+            long double total = 0;
+            for (auto value : m_values_) total += value;
+            return (double)(total / m_values_.size());
+        }
+
+    private:
+        std::vector<std::uint64_t> m_values_;
+        bool                       m_sorted_ = true;
+
+        void
+        _M_sort()
+        {
+            if (m_sorted_) return;
+            std::sort(m_values_.begin(), m_values_.end());
+            m_sorted_ = true;
+        }
+    };
+
+
+    /* One flat JSON object per run, printed on a single line so the
+       output of several benchmarks concatenates into JSON Lines. */
+    class report {
+    public:
+        explicit report(const std::string& __name)
+        { field("benchmark", __name); }
+
+        report&
+        field(const std::string& __key, const std::string& __value)
+        {
+            _M_key(__key);
+            m_os_ << '"' << __value << '"';
+            return *this;
+        }
+
+        report&
+        field(const std::string& __key, const char* __value)
+        { return field(__key, std::string(__value)); }
+
+        report&
+        field(const std::string& __key, std::uint64_t __value)
+        {
+            _M_key(__key);
+            m_os_ << __value;
+            return *this;
+        }
+
+        report&
+        field(const std::string& __key, double __value)
+        {
+            _M_key(__key);
+            m_os_ << std::fixed << std::setprecision(3) << __value;
+            return *this;
+        }
+
+        /* p50/p90/p99/p999/max in microseconds */
+        report&
+        latency(const std::string& __prefix, samples& __samples)
+        {
+            field(__prefix + "_p50_us",  __samples.percentile(0.50) / 1e3);
+            field(__prefix + "_p90_us",  __samples.percentile(0.90) / 1e3);
+            field(__prefix + "_p99_us",  __samples.percentile(0.99) / 1e3);
+            field(__prefix + "_p999_us", __samples.percentile(0.999) / 1e3);
+            field(__prefix + "_max_us",  __samples.percentile(1.0) / 1e3);
+            field(__prefix + "_mean_us", __samples.mean() / 1e3);
+            return *this;
+        }
+
+        void
+        print(std::ostream& __os = std::cout) const
+        { __os << "{" << m_os_.str() << "}" << std::endl; }
+
+    private:
+        std::ostringstream m_os_;
+        bool               m_first_ = true;
+
+        void
+        _M_key(const std::string& __key)
+        {
+            if (!m_first_) m_os_ << ",";
+            m_first_ = false;
+            m_os_ << '"' << __key << "\":";
+        }
+    };
+}}
+
+#endif
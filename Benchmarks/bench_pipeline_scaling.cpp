@@ -0,0 +1,110 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "sockets/basic_socket.h"
+#include "sockets/async_pipeline.h"
+#include "bench_common.h"
+
+#if !defined(__OS_WINDOWS__)
+    #include <sys/socket.h>
+    #include <sys/resource.h>
+#endif
+
+#include <thread>
+#include <vector>
+#include <memory>
+
+using namespace impact;
+using namespace impact::internal;
+
+
+struct connection {
+    basic_socket client;
+    basic_socket server;
+};
+
+
+static void
+raise_descriptor_limit()
+{
+#if !defined(__OS_WINDOWS__)
+    struct rlimit limit;
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        limit.rlim_cur = limit.rlim_max;
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+#endif
+}
+
+
+/* N idle connections sit in the pipeline while M active ones echo a
+   byte back per round; a round ends when every active client has its
+   echo, so round time is the cost of one loop pass over N + M. */
+int main(int argc, char** argv) {
+    auto idle   = bench::option(argc, argv, "idle", 1000);
+    auto active = bench::option(argc, argv, "active", 16);
+    auto rounds = bench::option(argc, argv, "rounds", 2000);
+    raise_descriptor_limit();
+
+    auto listener = make_tcp_socket();
+    listener.reuse_address(true);
+    listener.bind("127.0.0.1", 0);
+    listener.listen(1024);
+    auto port = listener.local_port();
+
+    std::vector<connection> connections(idle + active);
+    for (auto& pair : connections) {
+        pair.client = make_tcp_socket();
+        pair.client.connect(port, "127.0.0.1");
+        pair.server = listener.accept();
+        pair.client.no_delay(true);
+        pair.server.no_delay(true);
+    }
+
+    auto& pipeline = async_pipeline::instance();
+    auto echo = std::make_shared<async_functor>(
+        [](poll_handle* __handle, socket_error __error) -> async_option {
+            if (__error != socket_error::SUCCESS) return async_option::QUIT;
+            char byte;
+            auto size = ::recv(__handle->socket, (char*)&byte, 1, 0);
+            if (size <= 0) return async_option::QUIT;
+            ::send(__handle->socket, (const char*)&byte, 1, 0);
+            return async_option::CONTINUE;
+        });
+    for (auto& pair : connections)
+        pipeline.add_object(pair.server.get(), echo);
+
+    auto active_begin = connections.begin() + idle;
+    bench::samples round_times;
+    round_times.reserve(rounds);
+    auto start = bench::clock::now();
+    for (std::uint64_t r = 0; r < rounds; r++) {
+        auto begin = bench::clock::now();
+        char byte  = 'x';
+        for (auto it = active_begin; it != connections.end(); it++)
+            it->client.send(&byte, 1);
+        for (auto it = active_begin; it != connections.end(); it++)
+            it->client.recv(&byte, 1);
+        round_times.add(bench::elapsed_ns(begin));
+    }
+    auto seconds = bench::elapsed_ns(start) / 1e9;
+
+    for (auto& pair : connections)
+        pipeline.remove_object(pair.server.get());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    for (auto& pair : connections) {
+        pair.client.close();
+        pair.server.close();
+    }
+    listener.close();
+
+    bench::report("pipeline_scaling")
+        .field("idle", idle)
+        .field("active", active)
+        .field("rounds", rounds)
+        .field("echoes_per_second", rounds * active / seconds)
+        .latency("round", round_times)
+        .print();
+    return 0;
+}
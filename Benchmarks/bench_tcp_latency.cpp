@@ -0,0 +1,77 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include "utils/impact_error.h"
+#include "sockets/basic_socket.h"
+#include "bench_common.h"
+
+using namespace impact;
+
+
+static void
+receive_all(
+    basic_socket& __socket,
+    char*         __buffer,
+    int           __length)
+{
+    int received = 0;
+    while (received < __length) {
+        auto status = __socket.recv(__buffer + received, __length - received);
+        if (status <= 0) throw impact_error("Peer closed");
+        received += status;
+    }
+}
+
+
+int main(int argc, char** argv) {
+    auto iterations = bench::option(argc, argv, "iterations", 20000);
+    auto warmup     = bench::option(argc, argv, "warmup", 1000);
+    auto size       = (int)bench::option(argc, argv, "size", 64);
+
+    auto server = make_tcp_socket();
+    server.reuse_address(true);
+    server.bind("127.0.0.1", 0);
+    server.listen();
+
+    std::thread echo([&]() {
+        auto peer = server.accept();
+        peer.no_delay(true);
+        std::vector<char> buffer(size);
+        try {
+            while (true) {
+                receive_all(peer, buffer.data(), size);
+                peer.send(buffer.data(), size);
+            }
+        }
+        catch (...) { }
+    });
+
+    auto client = make_tcp_socket();
+    client.connect(server.local_port(), "127.0.0.1");
+    client.no_delay(true);
+
+    std::vector<char> buffer(size, 'x');
+    bench::samples round_trips;
+    round_trips.reserve(iterations);
+    for (std::uint64_t i = 0; i < warmup + iterations; i++) {
+        auto start = bench::clock::now();
+        client.send(buffer.data(), size);
+        receive_all(client, buffer.data(), size);
+        if (i >= warmup) round_trips.add(bench::elapsed_ns(start));
+    }
+
+    client.close();
+    echo.join();
+    server.close();
+
+    bench::report("tcp_latency")
+        .field("message_bytes", (std::uint64_t)size)
+        .field("iterations", iterations)
+        .latency("rtt", round_trips)
+        .print();
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include "sockets/basic_socket.h"
+#include "bench_common.h"
+
+using namespace impact;
+
+
+int main(int argc, char** argv) {
+    auto megabytes = bench::option(argc, argv, "megabytes", 1024);
+    auto chunk     = (int)bench::option(argc, argv, "chunk", 64 * 1024);
+    auto total     = megabytes * 1024 * 1024;
+
+    auto server = make_tcp_socket();
+    server.reuse_address(true);
+    server.bind("127.0.0.1", 0);
+    server.listen();
+
+    std::uint64_t received = 0;
+    std::thread sink([&]() {
+        auto peer = server.accept();
+        std::vector<char> buffer(chunk);
+        int status;
+        while ((status = peer.recv(buffer.data(), chunk)) > 0)
+            received += status;
+        peer.close();
+    });
+
+    auto client = make_tcp_socket();
+    client.connect(server.local_port(), "127.0.0.1");
+
+    std::vector<char> buffer(chunk, 'x');
+    auto start = bench::clock::now();
+    std::uint64_t sent = 0;
+    while (sent < total) {
+        auto length = (int)std::min<std::uint64_t>(chunk, total - sent);
+        sent += client.send(buffer.data(), length);
+    }
+    client.shutdown(socket_channel::WRITE);
+    sink.join();
+    auto elapsed = bench::elapsed_ns(start);
+    client.close();
+    server.close();
+
+    auto seconds = elapsed / 1e9;
+    bench::report("tcp_throughput")
+        .field("chunk_bytes", (std::uint64_t)chunk)
+        .field("bytes", received)
+        .field("seconds", seconds)
+        .field("megabytes_per_second", received / seconds / (1024 * 1024))
+        .field("gigabits_per_second", received * 8 / seconds / 1e9)
+        .print();
+    return received == total ? 0 : 1;
+}
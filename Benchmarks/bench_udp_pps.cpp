@@ -0,0 +1,77 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "utils/impact_error.h"
+#include "sockets/basic_socket.h"
+#include "sockets/probe.h"
+#include "bench_common.h"
+
+using namespace impact;
+
+
+int main(int argc, char** argv) {
+    auto packets = bench::option(argc, argv, "packets", 500000);
+    auto size    = (int)bench::option(argc, argv, "size", 64);
+
+    auto receiver = make_udp_socket();
+    receiver.bind("127.0.0.1", 0);
+    receiver.receive_buffer_size(4 * 1024 * 1024);
+    auto port = receiver.local_port();
+
+    std::atomic<bool> sending(true);
+    std::uint64_t received = 0;
+    bench::clock::time_point last;
+    std::thread sink([&]() {
+        std::vector<char> buffer(size);
+        std::vector<poll_handle> handles(1);
+        handles[0].socket = receiver.get();
+        handles[0].events = (short)poll_flags::IN;
+        /* stop once the sender is done and the socket stays quiet */
+        while (true) {
+            handles[0].return_events = 0;
+            auto status = poll(&handles, 100);
+            if (status <= 0) {
+                if (!sending) break;
+                continue;
+            }
+            receiver.recv(buffer.data(), size);
+            received++;
+            last = bench::clock::now();
+        }
+    });
+
+    auto sender = make_udp_socket();
+    sender.connect(port, "127.0.0.1");
+    std::vector<char> buffer(size, 'x');
+    auto start = bench::clock::now();
+    std::uint64_t dropped_sends = 0;
+    for (std::uint64_t i = 0; i < packets; i++) {
+        try { sender.send(buffer.data(), size); }
+        catch (impact_error&) { dropped_sends++; } /* ENOBUFS */
+    }
+    auto send_seconds = bench::elapsed_ns(start) / 1e9;
+    sending = false;
+    sink.join();
+    sender.close();
+    receiver.close();
+
+    auto receive_seconds = received ?
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            last - start).count() / 1e9 : 0.0;
+    bench::report("udp_pps")
+        .field("packet_bytes", (std::uint64_t)size)
+        .field("sent", packets - dropped_sends)
+        .field("received", received)
+        .field("send_pps", (packets - dropped_sends) / send_seconds)
+        .field("receive_pps", receive_seconds > 0 ?
+            received / receive_seconds : 0.0)
+        .field("loss_ratio", packets ?
+            1.0 - (double)received / (double)packets : 0.0)
+        .print();
+    return 0;
+}
@@ -135,6 +135,69 @@ int main(void) {        \n\
 " HAVE_FALLTHROUGH_ATTRIBUTE)
 SET(HAVE_FALLTHROUGH_ATTRIBUTE ${HAVE_FALLTHROUGH_ATTRIBUTE} ${SCOPE})
 
+CHECK_CXX_SOURCE_COMPILES(" \
+#include <sys/epoll.h>                      \n\
+int main(void) {                            \n\
+    struct epoll_event event;               \n\
+    int fd = epoll_create1(EPOLL_CLOEXEC);  \n\
+    return epoll_wait(fd, &event, 1, 0);    \n\
+}                                           \
+" HAVE_EPOLL)
+SET(HAVE_EPOLL ${HAVE_EPOLL} ${SCOPE})
+
+CHECK_CXX_SOURCE_COMPILES(" \
+#include <sys/epoll.h>                      \n\
+#include <time.h>                           \n\
+int main(void) {                            \n\
+    struct epoll_event event;               \n\
+    struct timespec time = { 0, 1000 };     \n\
+    int fd = epoll_create1(EPOLL_CLOEXEC);  \n\
+    return epoll_pwait2(fd, &event, 1, &time, 0); \n\
+}                                           \
+" HAVE_EPOLL_PWAIT2)
+SET(HAVE_EPOLL_PWAIT2 ${HAVE_EPOLL_PWAIT2} ${SCOPE})
+
+# SIMD kernels are compiled per function with target attributes,
+# so the library still runs on CPUs without them (utils/cpu_features.h)
+CHECK_CXX_SOURCE_COMPILES(" \
+#include <cpuid.h>                          \n\
+#include <immintrin.h>                      \n\
+__attribute__((target(\"avx512f,avx512bw,avx512vbmi\"))) \n\
+static int wide(const char* p) {            \n\
+    __m512i v = _mm512_loadu_si512(p);      \n\
+    v = _mm512_permutexvar_epi8(v, v);      \n\
+    return (int)_mm512_movepi8_mask(v);     \n\
+}                                           \n\
+int main(void) {                            \n\
+    unsigned int a, b, c, d;                \n\
+    char buffer[64] = { 0 };                \n\
+    __get_cpuid_count(7, 0, &a, &b, &c, &d); \n\
+    return __builtin_cpu_supports(\"avx2\") ? wide(buffer) : 0; \n\
+}                                           \
+" HAVE_X86_SIMD)
+SET(HAVE_X86_SIMD ${HAVE_X86_SIMD} ${SCOPE})
+
+# the library itself stays C++11; only the optional
+# coroutine layer (sockets/coroutine.h) needs C++20
+SET(TMP_COROUTINE_FLAGS "${CMAKE_REQUIRED_FLAGS}")
+SET(CMAKE_REQUIRED_FLAGS "${CMAKE_REQUIRED_FLAGS} -std=c++20")
+CHECK_CXX_SOURCE_COMPILES(" \
+#include <coroutine>                        \n\
+struct task {                               \n\
+    struct promise_type {                   \n\
+        task get_return_object() { return {}; } \n\
+        std::suspend_never initial_suspend() noexcept { return {}; } \n\
+        std::suspend_never final_suspend() noexcept { return {}; }   \n\
+        void return_void() {}               \n\
+        void unhandled_exception() {}       \n\
+    };                                     \n\
+};                                         \n\
+task run() { co_await std::suspend_never{}; } \n\
+int main(void) { run(); return 0; }       \
+" HAVE_COROUTINES)
+SET(HAVE_COROUTINES ${HAVE_COROUTINES} ${SCOPE})
+SET(CMAKE_REQUIRED_FLAGS "${TMP_COROUTINE_FLAGS}")
+
 
 IF (UNIX)
     SET(CMAKE_REQUIRED_FLAGS "${TMP_REQ_FLAGS}")
@@ -64,6 +64,7 @@ SET(SOCKETS_INCLUDE_DIR ${SOCKETS_DIR}/Include)
 SET(SOCKETS_SOURCE_DIR  ${SOCKETS_DIR}/Source)
 SET(EXAMPLES_DIR        ${CMAKE_CURRENT_SOURCE_DIR}/Examples)
 SET(TESTS_DIR           ${CMAKE_CURRENT_SOURCE_DIR}/Tests)
+SET(BENCHMARKS_DIR      ${CMAKE_CURRENT_SOURCE_DIR}/Benchmarks)
 
 OPTION(BUILD_STATIC "Build static libraries." ON)
 IF (NOT MSVC)
@@ -6,7 +6,9 @@
 #define _IMPACT_RFC_BASE64_H_
 
 #include <string>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 
 #ifndef RFC4648
     #define RFC4648 1 /* base 64 */
@@ -15,31 +17,135 @@
 namespace impact {
     class base64 {
     public:
-        static bool encode(const std::string& data, std::string* result);
-        static bool decode(const std::string& data, std::string* result);
+        /* Variants without extra passes over the data: every option is
+           applied while encoding or decoding. */
+        struct options {
+            /* RFC 4648 section 5: '-' and '_' replace '+' and '/' */
+            bool   url_safe;
+            /* encode: emit '=' padding; decode: when false, a tail
+               without padding is accepted as well */
+            bool   padding;
+            /* encode: CRLF between lines of this many characters,
+               rounded down to a multiple of 4 (RFC 2045 uses 76);
+               decode: CR and LF are skipped. 0 for a single line. */
+            size_t line_length;
+
+            options() noexcept;
+            static options url() noexcept;  /* url_safe, no padding */
+            static options mime() noexcept; /* 76 columns           */
+        };
+
+        static bool encode(const std::string& data, std::string* result,
+            const options& variant = options());
+        static bool decode(const std::string& data, std::string* result,
+            const options& variant = options());
+
+        /* caller-supplied buffers; nothing is allocated */
+        static size_t encoded_size(size_t length,
+            const options& variant = options()) noexcept;
+        /* upper bound; the exact size is returned by decode() */
+        static size_t decoded_size(size_t length) noexcept;
+        /* writes exactly encoded_size(length) characters to result */
+        static size_t encode(const void* data, size_t length, char* result,
+            const options& variant = options()) noexcept;
+        /* result must hold decoded_size(length) bytes */
+        static bool decode(const char* data, size_t length, void* result,
+            size_t* written, const options& variant = options()) noexcept;
+
+        /* reads until EOF through fixed-size buffers, so memory stays
+           constant for any payload; false on a bad symbol, a short
+           write or a stream error */
+        static bool encode(std::istream& data, std::ostream& result,
+            const options& variant = options());
+        static bool decode(std::istream& data, std::ostream& result,
+            const options& variant = options());
+
+
+        /* Incremental encoder: feed chunks of any size, carrying up to
+           two bytes between calls, then finish() to pad the tail. */
+        class encoder {
+        public:
+            explicit encoder(const options& variant = options()) noexcept;
+
+            /* most characters update() writes for length bytes */
+            size_t max_output(size_t length) const noexcept;
+
+            size_t update(const void* data, size_t length, char* result)
+                noexcept;
+            /* writes at most 6 characters and starts over */
+            size_t finish(char* result) noexcept;
+
+            /* append to result */
+            void update(const std::string& data, std::string* result);
+            void finish(std::string* result);
+
+            void reset() noexcept;
+
+        private:
+            options       m_options_;
+            size_t        m_line_;
+            size_t        m_column_;
+            unsigned char m_carry_[2];
+            unsigned int  m_carried_;
+
+            char* _M_encode(const unsigned char* data, size_t length,
+                char* output) noexcept;
+        };
+
+
+        /* Incremental decoder: carries up to three symbols between
+           calls. Padding is checked by finish(); stray pads inside the
+           data are skipped as in decode(). After an error every call
+           fails until reset(). */
+        class decoder {
+        public:
+            explicit decoder(const options& variant = options()) noexcept;
+
+            /* most bytes update() writes for length symbols */
+            static size_t max_output(size_t length) noexcept;
+
+            bool update(const char* data, size_t length, void* result,
+                size_t* written) noexcept;
+            /* writes at most 2 bytes and starts over */
+            bool finish(void* result, size_t* written) noexcept;
+
+            /* append to result */
+            bool update(const std::string& data, std::string* result);
+            bool finish(std::string* result);
+
+            void reset() noexcept;
+
+        private:
+            options       m_options_;
+            std::uint32_t m_group_;
+            unsigned int  m_tally_;
+            unsigned int  m_padding_;
+            bool          m_failed_;
+
+            bool _M_segment(const char* data, size_t length,
+                unsigned char** output) noexcept;
+            bool _M_push(char symbol, unsigned char** output) noexcept;
+        };
 
     private:
         static const std::string   k_alphabet;
         static const char          k_pad;
-        static const unsigned char k_symbol_size;
-        static const unsigned char k_symbol;
-        static const unsigned char k_byte;
 
         base64();
-        static unsigned char _S_reverse_lookup(const char);
-        static void _S_run_encode(const std::string&,std::ostringstream*);
-        static void _S_pad_stream(const std::string&,std::ostringstream*);
-        static bool _S_run_decode(
-            const std::string&  data,
-            std::ostringstream* stream,
-            unsigned short*     padding,
-            unsigned short*     tally,
-            unsigned int*       reg24);
-        static bool _S_unpad_stream(
-            std::ostringstream* stream,
-            unsigned short*     padding,
-            unsigned short*     tally,
-            unsigned int*       reg24);
+        /* Kernels up to the given internal::simd_level, passed as an
+           int, do the bulk of the work. These ignore line_length:
+           encoder and decoder handle the lines. */
+        static size_t _S_encode(const unsigned char*, size_t, char*,
+            int level, const options&) noexcept;
+        static bool _S_decode(const char*, size_t, unsigned char*, size_t*,
+            int level, const options&) noexcept;
+        static bool _S_decode_lenient(const char*, size_t, unsigned char*,
+            size_t*, const options&) noexcept;
+        static bool _S_decode_tail(std::uint32_t group, unsigned int tally,
+            unsigned int padding, const options&, unsigned char** output)
+            noexcept;
+
+        friend class test_base64_c; /* guts private access */
     };
 }
 
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <string>
+#include <cstddef>
 #include "utils/environment.h"
 
 #define RFC1321 1
@@ -15,9 +16,30 @@
 namespace impact {
     class md5 {
     public:
-        md5() = delete;
-        
-        static std::string digest(std::string message);
+        static const unsigned int HASH_SIZE = 16;
+
+        static std::string digest(const std::string& message);
+
+        /* Many independent messages at once, 4, 8 or 16 at a time in
+           SIMD lanes; message i's digest goes to results + i * HASH_SIZE */
+        static void digest(const void* const* messages,
+            const size_t* lengths, size_t count, unsigned char* results)
+            noexcept;
+        static void digest(const std::string* messages, size_t count,
+            unsigned char* results) noexcept;
+
+        /* Incremental hasher: 64-byte blocks are hashed straight from
+           the caller's memory and only the last one is padded, on the
+           stack, by finalize(). */
+        md5() noexcept;
+
+        void update(const void* data, size_t length) noexcept;
+        void update(const std::string& data) noexcept;
+        /* writes HASH_SIZE bytes and starts over */
+        void finalize(unsigned char* result) noexcept;
+        std::string finalize();
+
+        void reset() noexcept;
         
     private:
         #if defined(HAVE_UINT32_T)
@@ -26,11 +48,17 @@ namespace impact {
             typedef unsigned long int var;
         #endif
         
-        static var s[64];
-        static var K[64];
+        var                m_state_[4];
+        unsigned long long m_length_;    /* bytes so far */
+        unsigned char      m_block_[64]; /* m_length_ % 64 are buffered */
         
-        static void _S_preprocess(std::string*);
-        static std::string _S_process(const std::string&);
+        static void _S_transform(var* state, const unsigned char* block)
+            noexcept;
+        /* level is an internal::simd_level */
+        static void _S_digest(const void* const*, const size_t*, size_t,
+            unsigned char*, int level) noexcept;
+
+        friend class test_md5_c; /* guts private access */
     };
 }
 
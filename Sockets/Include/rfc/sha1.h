@@ -9,17 +9,39 @@
 #define SHA1_H
 
 #include <string>
+#include <cstddef>
 
 #define RFC3174 1
 
 namespace impact {
     class sha1 {
     public:
-        static std::string digest(std::string message);
+        static const unsigned int HASH_SIZE = 20;
+
+        static std::string digest(const std::string& message);
+
+        /* Many independent messages at once, 4, 8 or 16 at a time in
+           SIMD lanes; message i's digest goes to results + i * HASH_SIZE.
+           Unlike md5, sha1 caps a message below 2^61 bytes: longer ones
+           throw impact_error before anything is hashed. */
+        static void digest(const void* const* messages,
+            const size_t* lengths, size_t count, unsigned char* results);
+        static void digest(const std::string* messages, size_t count,
+            unsigned char* results);
+
+        /* Incremental hasher: feed the message in chunks of any size
+           without buffering it, then finalize() for the digest. */
+        sha1() noexcept;
+
+        void update(const void* data, size_t length);
+        void update(const std::string& data);
+        /* writes HASH_SIZE bytes and starts over */
+        void finalize(unsigned char* result);
+        std::string finalize();
+
+        void reset() noexcept;
     
     private:
-        static const unsigned int HASH_SIZE;
-        
         enum class STATUS {
             SUCCESS = 0,
             NIL,
@@ -36,14 +58,28 @@ namespace impact {
             bool computed;
             bool corrupted;
         };
+
+        struct context m_context_;
         
         static void _S_pad_message(struct context*);
-        static void _S_process_message_block(struct context*);
+        static void _S_process_message_block(struct context*,
+            const unsigned char* block);
+        /* whole blocks through the kernel for the given level (an
+           internal::simd_level), or the SHA extensions when sha_ni
+           is set */
+        static void _S_process_blocks(struct context*,
+            const unsigned char* data, size_t blocks, int level,
+            bool sha_ni) noexcept;
         static STATUS _S_reset(struct context*);
         static STATUS _S_input(struct context*, const unsigned char*,
-            unsigned int);
+            size_t);
         static STATUS _S_result(struct context*, unsigned char*);
+        static void _S_check(STATUS);
+        static void _S_digest(const void* const*, const size_t*, size_t,
+            unsigned char*, int level);
+
+        friend class test_sha1_c; /* guts private access */
     };
 }
 
-#endif
\ No newline at end of file
+#endif
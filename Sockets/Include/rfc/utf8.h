@@ -21,8 +21,43 @@ namespace impact {
         static bool serialize(const std::u16string& input, std::string* result);
         static bool serialize(const std::u32string& input, std::string* result);
         static bool deserialize(const std::string& input, std::u32string* result);
+        /* named apart so deserialize(input, NULL) stays unambiguous */
+        static bool deserialize_utf16(const std::string& input,
+            std::u16string* result);
+
+        /* Caller-supplied buffers; nothing is allocated. UTF-16 input
+           takes up to 3 bytes of result per unit and UTF-32 up to 4.
+           Decoding takes at most one unit per input byte. A failed
+           serialize leaves the valid prefix in result and written;
+           a failed deserialize writes nothing. */
+        static bool serialize(const char16_t* data, size_t length,
+            char* result, size_t* written) noexcept;
+        static bool serialize(const char32_t* data, size_t length,
+            char* result, size_t* written) noexcept;
+        static bool deserialize(const char* data, size_t length,
+            char16_t* result, size_t* written) noexcept;
+        static bool deserialize(const char* data, size_t length,
+            char32_t* result, size_t* written) noexcept;
+
+        /* well-formed per RFC 3629: no overlong forms, surrogates or
+           code points above U+10FFFF; sets imp_errno either way */
+        static bool validate(const std::string& input);
+        static bool validate(const char* data, size_t length);
 
     private:
+        /* level is an internal::simd_level */
+        static bool _S_validate(const unsigned char* __data, size_t __length,
+            int __level, size_t* __symbols) noexcept;
+        /* Kernels up to the given level copy the ASCII runs. Decoding
+           expects input that _S_validate accepted. */
+        static bool _S_serialize(const char16_t*, size_t, unsigned char*,
+            size_t*, int level) noexcept;
+        static bool _S_serialize(const char32_t*, size_t, unsigned char*,
+            size_t*, int level) noexcept;
+        static size_t _S_deserialize(const unsigned char*, size_t, char16_t*,
+            int level) noexcept;
+        static size_t _S_deserialize(const unsigned char*, size_t, char32_t*,
+            int level) noexcept;
         static inline size_t _S_estimate_buf_size(char32_t __symbol) {
             if (__symbol <= 0x00007F) return 1;
             if (__symbol <= 0x0007FF) return 2;
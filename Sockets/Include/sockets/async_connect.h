@@ -0,0 +1,32 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_ASYNC_CONNECT_H_
+#define _IMPACT_ASYNC_CONNECT_H_
+
+#include <string>
+#include <chrono>
+#include <functional>
+
+#include "sockets/types.h"
+#include "sockets/basic_socket.h"
+
+namespace impact {
+    typedef std::function<void(basic_socket,socket_error)> connect_callback;
+
+    /* Non-blocking TCP connect using Happy Eyeballs (RFC 8305).
+       Resolves 'host' off the pipeline thread, interleaves IPv6 and IPv4
+       candidates, and starts a new attempt every 'attempt_delay' (or as
+       soon as one fails) until one succeeds or 'timeout' expires. Losing
+       attempts are closed. The callback runs once on the pipeline
+       thread, with a blocking connected socket and SUCCESS, or with an
+       invalid socket and the last failure (TIMED_OUT on expiry, OTHER
+       if the name could not be resolved). */
+    void async_connect(const std::string& host, unsigned short port,
+        std::chrono::milliseconds timeout, connect_callback callback,
+        std::chrono::milliseconds attempt_delay =
+            std::chrono::milliseconds(250)) /* throw(impact_error) */;
+}
+
+#endif
@@ -10,13 +10,17 @@
 #include <mutex>
 #include <atomic>
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include <memory>
 #include <functional>
+#include <chrono>
+#include <typeinfo>
 
 #include "sockets/probe.h"
 #include "sockets/basic_socket.h"
+#include "utils/thread_pool.h"
+#include "utils/mpsc_queue.h"
 
 #if defined(__OS_WINDOWS__)
     /* used as async_option, windows defines it as 0 */
@@ -26,7 +30,56 @@
 namespace impact {
 namespace internal {
     class async_object;
-    typedef std::shared_ptr<async_object> async_object_ptr;
+    class async_batch_object;
+    typedef std::shared_ptr<async_object>       async_object_ptr;
+    typedef std::shared_ptr<async_batch_object> async_batch_ptr;
+    
+    
+    typedef enum class async_option {
+        CONTINUE,
+        IGNORE,
+        QUIT
+    } AsyncOption;
+    
+    
+    class async_object {
+    public:
+        virtual async_option async_callback(poll_handle* handle,
+            socket_error error) = 0;
+    };
+
+
+    typedef struct ready_event {
+        poll_handle* handle;
+        socket_error error;
+        async_option option; /* set by on_ready(); CONTINUE by default */
+    } ReadyEvent;
+
+
+    /* Receives all of its ready sockets in a single call per
+       pipeline iteration instead of one callback per socket. */
+    class async_batch_object {
+    public:
+        virtual void on_ready(ready_event* events, size_t count) = 0;
+    };
+
+
+    /* One-shot deadline callback, invoked on the pipeline thread.
+       The pipeline does not own timers; keep them alive until they
+       fire or until cancel_timer() has been applied. */
+    class async_timer {
+    public:
+        virtual void on_timer() = 0;
+    };
+
+
+    /* One callback that held the pipeline thread past the threshold. */
+    typedef struct slow_callback {
+        int                      socket;  /* -1 for timers                 */
+        size_t                   handles; /* sockets handed to the call    */
+        const std::type_info*    type;    /* dynamic type of the callee    */
+        std::chrono::nanoseconds elapsed;
+    } SlowCallback;
     
     
     class async_pipeline {
@@ -37,56 +90,128 @@ namespace internal {
 
         ~async_pipeline();
         
+        typedef std::chrono::steady_clock clock;
+
         void granularity(int milliseconds);
-        void add_object(int socket, async_object_ptr object) /* throw(impact_error) */;
+        void add_object(int socket, async_object_ptr object,
+            short events = (short)poll_flags::IN) /* throw(impact_error) */;
+        void add_object(int socket, async_batch_ptr object,
+            short events = (short)poll_flags::IN) /* throw(impact_error) */;
         void remove_object(int socket) /* throw(impact_error) */;
+        /* dispatch every registered object once, including ignored ones */
         void notify();
 
+        /* applied immediately on the pipeline thread, queued otherwise */
+        void add_timer(async_timer* timer, clock::time_point deadline)
+            /* throw(impact_error) */;
+        void cancel_timer(async_timer* timer) /* throw(impact_error) */;
+        bool in_pipeline() const noexcept;
+
+        /* registration requests from producer threads,
+           drained by the pipeline thread every iteration */
+        struct command : public mpsc_node {
+            enum class action { ADD, REMOVE, ADD_TIMER, CANCEL_TIMER };
+            action            type;
+            int               socket;
+            short             events;
+            async_object_ptr  object;
+            async_batch_ptr   batch;
+            async_timer*      timer;
+            clock::time_point deadline;
+            bool              owned; /* deleted by the pipeline once applied */
+            command();
+        };
+
+        /* allocation-free registration: the caller owns the request
+           and keeps it alive until the pipeline has applied it */
+        void submit(command* request) /* throw(impact_error) */;
+
+        /* run CPU-bound work off the pipeline thread; the pool is
+           created on first use with the options given beforehand */
+        void offload(std::function<void()> task) /* throw(impact_error) */;
+        void pool_options(const thread_pool::options& options)
+            /* throw(impact_error) */;
+
+        /* Flag callbacks (objects, batches and timers) that run longer
+           than threshold; zero turns detection off. The handler runs on
+           the pipeline thread; without one, a line goes to std::cerr. */
+        typedef std::function<void(const slow_callback&)> slow_handler;
+        void slow_callback_threshold(std::chrono::nanoseconds threshold,
+            slow_handler handler = nullptr);
+
     private:
         async_pipeline();
-        typedef std::pair<int, async_object_ptr> handle_info;
+
+        struct handle_info {
+            async_object_ptr object;
+            async_batch_ptr  batch;
+            short            events;
+        };
+
+        struct timer_info {
+            clock::time_point deadline;
+            async_timer*      timer;
+            bool operator>(const timer_info& rhs) const noexcept;
+        };
         
         std::thread                    m_thread_;
+        std::atomic<std::thread::id>   m_thread_id_;
         std::condition_variable        m_thread_cv_;
         std::mutex                     m_thread_mtx_;
         std::atomic<bool>              m_thread_ready_;
         std::atomic<bool>              m_thread_closing_;
         std::atomic<bool>              m_thread_has_work_;
-        std::atomic<int>               m_thread_pending_;
+        std::atomic<bool>              m_thread_sleeping_;
+        std::atomic<bool>              m_thread_notified_;
         
-        std::mutex                     m_work_mtx_;
+        mpsc_queue                     m_commands_;
+        /* parallel arrays; m_work_index_ maps a socket to its slot */
         std::vector<poll_handle>       m_work_handles_;
-        std::map<int,async_object_ptr> m_work_info_;
-        std::vector<handle_info>       m_work_pending_;
-        std::vector<int>               m_work_removed_;
+        std::vector<handle_info>       m_work_info_;
+        std::unordered_map<int,size_t> m_work_index_;
         std::atomic<int>               m_poll_granularity_;
+
+        /* dispatch scratch space, reused between iterations */
+        std::vector<size_t>            m_ready_;
+        std::vector<async_option>      m_ready_options_;
+        std::vector<size_t>            m_batch_slots_;
+        std::vector<ready_event>       m_batch_events_;
+
+        /* min-heap ordered by deadline; pipeline thread only */
+        std::vector<timer_info>        m_timers_;
         
+        std::mutex                     m_pool_mtx_;
+        thread_pool::options           m_pool_options_;
+        std::unique_ptr<thread_pool>   m_pool_;
+        std::atomic<thread_pool*>      m_pool_ptr_;
+
+        std::atomic<long long>         m_slow_threshold_; /* nanoseconds */
+        std::mutex                     m_slow_mtx_;
+        slow_handler                   m_slow_handler_;
+
         const int                      k_default_granularity_ = 50;
 
-        void _M_notify_pending(int);
-        void _M_copy_pending_to_queue();
-        void _M_remove_pending_from_queue();
-        bool _M_update_handles();
+        void _M_wake();
+        void _M_drain_commands();
+        void _M_apply(command*);
+        void _M_add_handle(int, short, async_object_ptr, async_batch_ptr);
+        void _M_remove_handle(int);
+        void _M_add_timer(async_timer*, clock::time_point);
+        void _M_cancel_timer(async_timer*);
+        int  _M_timer_timeout(int);
+        void _M_fire_timers();
+        clock::time_point _M_profile_begin() const noexcept;
+        void _M_profile_end(clock::time_point, int, size_t,
+            const std::type_info&);
+        void _M_erase_slot(size_t);
+        void _M_dispatch_batches(socket_error);
+        bool _M_update_handles(int);
         void _M_dowork();
         void _M_begin();
         void _M_end();
     };
     
     
-    typedef enum class async_option {
-        CONTINUE,
-        IGNORE,
-        QUIT
-    } AsyncOption;
-    
-    
-    class async_object {
-    public:
-        virtual async_option async_callback(poll_handle* handle,
-            socket_error error) = 0;
-    };
-    
-    
     class async_functor : public async_object {
     public:
         async_functor(std::function<async_option(poll_handle*,socket_error)> callback);
@@ -88,11 +88,45 @@ namespace impact {
             /* throw(impact_error) */;
         void reuse_address(bool enabled)
             /* throw(impact_error) */;
+        void busy_poll(unsigned int microseconds)
+            /* throw(impact_error) */;
+        void prefer_busy_poll(bool enabled)
+            /* throw(impact_error) */;
+        void non_blocking(bool enabled)
+            /* throw(impact_error) */;
+
+        // tuning
+        void no_delay(bool enabled)       /* throw(impact_error) */;
+        bool no_delay()                   /* throw(impact_error) */;
+        void cork(bool enabled)           /* throw(impact_error) */;
+        bool cork()                       /* throw(impact_error) */;
+        void send_buffer_size(int bytes)  /* throw(impact_error) */;
+        int send_buffer_size()            /* throw(impact_error) */;
+        void receive_buffer_size(int bytes) /* throw(impact_error) */;
+        int receive_buffer_size()         /* throw(impact_error) */;
+        void notsent_lowat(int bytes)     /* throw(impact_error) */;
+        int notsent_lowat()               /* throw(impact_error) */;
+        void quick_ack(bool enabled)      /* throw(impact_error) */;
+        void priority(int level)          /* throw(impact_error) */;
+        int priority()                    /* throw(impact_error) */;
+        /* presets; options the platform lacks are skipped */
+        void latency_profile()            /* throw(impact_error) */;
+        void throughput_profile(int buffer_bytes = 0)
+            /* throw(impact_error) */;
+
+        // statistics
+        struct tcp_statistics tcp_info() /* throw(impact_error) */;
+        /* bytes written but not yet acknowledged by the peer */
+        int send_queue()                  /* throw(impact_error) */;
+        /* bytes received but not yet read */
+        int receive_queue()               /* throw(impact_error) */;
 
         friend basic_socket make_socket(
             address_family, socket_type, internet_protocol);
         friend basic_socket make_tcp_socket();
         friend basic_socket make_udp_socket();
+        friend basic_socket adopt_socket(int, address_family, socket_type,
+            internet_protocol);
 
     private:
         struct basic_socket_info {
@@ -108,6 +142,9 @@ namespace impact {
         unsigned short _M_resolve_service(const std::string& __service,
             const std::string& __protocol = "tcp");
 
+        void _M_set_option(int __level, int __name, int __value);
+        int  _M_get_option(int __level, int __name);
+
         void _M_copy(const basic_socket& __rhs);
         void _M_move(basic_socket&& __rhs);
         void _M_dtor();
@@ -117,6 +154,9 @@ namespace impact {
         internet_protocol proto)   /* throw(impact_error) */;
     basic_socket make_tcp_socket() /* throw(impact_error) */;
     basic_socket make_udp_socket() /* throw(impact_error) */;
+    /* takes ownership of an already open descriptor */
+    basic_socket adopt_socket(int descriptor, address_family domain,
+        socket_type type, internet_protocol proto) /* throw(impact_error) */;
 }
 
 #endif
@@ -0,0 +1,75 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_CONNECTION_POOL_H_
+#define _IMPACT_CONNECTION_POOL_H_
+
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+
+#include "sockets/types.h"
+#include "sockets/basic_socket.h"
+
+namespace impact {
+    /* Keyed pool of connected TCP sockets ("host:port" -> idle sockets).
+       acquire() hands out the most recently released live connection
+       for a key, or connects a new one; release() returns it for reuse.
+       Every acquired socket must be released exactly once. */
+    class connection_pool {
+    public:
+        typedef std::chrono::steady_clock clock;
+
+        typedef struct options {
+            size_t                    max_idle;     /* idle sockets kept per key */
+            size_t                    max_total;    /* idle + in use; 0: no limit */
+            std::chrono::milliseconds idle_timeout; /* evict when idle this long */
+            bool                      use_keepalive;
+            struct keep_alive_options keepalive;    /* for new connections */
+            options();
+        } Options;
+
+        explicit connection_pool(struct options opts = options());
+        connection_pool(const connection_pool&) = delete;
+        connection_pool& operator=(const connection_pool&) = delete;
+        ~connection_pool();
+
+        basic_socket acquire(const std::string& host, unsigned short port)
+            /* throw(impact_error) */;
+        /* pass reusable = false after any protocol or I/O error */
+        void release(const std::string& host, unsigned short port,
+            basic_socket socket, bool reusable = true);
+
+        /* drop idle sockets that expired or were closed by the peer */
+        void evict_idle();
+        void clear();
+
+        size_t idle() const;
+        size_t active() const;
+
+    private:
+        struct idle_entry {
+            basic_socket      socket;
+            clock::time_point since;
+        };
+
+        typedef std::deque<idle_entry> idle_list; /* oldest first */
+
+        struct options                            m_options_;
+        mutable std::mutex                        m_mtx_;
+        std::unordered_map<std::string,idle_list> m_idle_;
+        size_t                                    m_idle_count_;
+        size_t                                    m_active_count_;
+
+        static std::string _S_key(const std::string&, unsigned short);
+        static bool _S_alive(const basic_socket&);
+        static void _S_close(basic_socket&);
+        void _M_evict_expired(idle_list&, clock::time_point);
+        bool _M_evict_oldest();
+    };
+}
+
+#endif
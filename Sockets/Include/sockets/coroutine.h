@@ -0,0 +1,306 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_COROUTINE_H_
+#define _IMPACT_COROUTINE_H_
+
+/* Optional C++20 layer; the rest of the library stays C++11.
+   Every awaiter suspends on async_pipeline readiness and resumes
+   inline on the pipeline thread. An awaiter embeds its own
+   registration request, so an operation allocates nothing beyond
+   the coroutine frame. A socket may have only one operation in
+   flight at a time, and a suspended frame must not be destroyed
+   before it resumes. */
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "utils/impact_error.h"
+#include "sockets/basic_socket.h"
+#include "sockets/async_pipeline.h"
+#include "sockets/nonblocking.h"
+#include "sockets/generic.h"
+
+namespace impact {
+    /* fire-and-forget: runs eagerly and frees its own frame;
+       an exception escaping the body terminates the program */
+    class async_task {
+    public:
+        struct promise_type {
+            async_task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+
+namespace internal {
+    class io_awaiter : public async_object {
+    public:
+        io_awaiter(const io_awaiter&) = delete;
+        io_awaiter& operator=(const io_awaiter&) = delete;
+
+        bool await_ready() {
+            /* try before suspending; most reads on a busy
+               connection complete without touching the pipeline */
+            return m_eager_ && _M_attempt();
+        }
+
+        void await_suspend(std::coroutine_handle<> __handle) {
+            m_handle_         = __handle;
+            m_request_.type   = async_pipeline::command::action::ADD;
+            m_request_.socket = m_socket_;
+            m_request_.events = m_events_;
+            m_request_.owned  = false;
+            /* non-owning: the awaiter lives in the coroutine frame */
+            m_request_.object = async_object_ptr(async_object_ptr(), this);
+            /* may resume on the pipeline thread before this returns */
+            async_pipeline::instance().submit(&m_request_);
+        }
+
+        async_option async_callback(poll_handle* __handle,
+            socket_error __error) {
+            if (__error != socket_error::SUCCESS)
+                m_error_ = __error;
+            /* notify() dispatches every handle, ready or not */
+            else if (__handle->return_events == 0 || !_M_attempt())
+                return async_option::CONTINUE;
+            /* the awaiter is gone once the coroutine moves on */
+            auto handle = m_handle_;
+            handle.resume();
+            return async_option::QUIT;
+        }
+
+    protected:
+        io_awaiter(int __socket, short __events, bool __eager)
+        : m_socket_(__socket), m_events_(__events), m_eager_(__eager),
+          m_error_(socket_error::SUCCESS)
+        {}
+
+        /* false while the operation would still block */
+        virtual bool _M_attempt() = 0;
+
+        void _M_check() const {
+            if (m_error_ != socket_error::SUCCESS)
+                throw impact_error(error_message((int)m_error_));
+        }
+
+        int                      m_socket_;
+        short                    m_events_;
+        bool                     m_eager_;
+        socket_error             m_error_;
+        std::coroutine_handle<>  m_handle_;
+        async_pipeline::command  m_request_;
+    };
+
+
+    class recv_awaiter : public io_awaiter {
+    public:
+        recv_awaiter(basic_socket& __socket, void* __buffer, int __length,
+            message_flags __flags)
+        : io_awaiter(__socket.get(), (short)poll_flags::IN, true),
+          m_buffer_(__buffer), m_length_(__length), m_flags_(__flags),
+          m_result_(0)
+        {}
+
+        int await_resume() const { _M_check(); return m_result_; }
+
+    private:
+        void*         m_buffer_;
+        int           m_length_;
+        message_flags m_flags_;
+        int           m_result_;
+
+        bool _M_attempt() {
+            m_result_ = try_recv(m_socket_, m_buffer_, m_length_,
+                m_flags_, &m_error_);
+            if (m_error_ != socket_error::WOULD_BLOCK) return true;
+            m_error_ = socket_error::SUCCESS;
+            return false;
+        }
+    };
+
+
+    class send_awaiter : public io_awaiter {
+    public:
+        send_awaiter(basic_socket& __socket, const void* __buffer,
+            int __length, message_flags __flags)
+        : io_awaiter(__socket.get(), (short)poll_flags::OUT, true),
+          m_buffer_(__buffer), m_length_(__length), m_flags_(__flags),
+          m_result_(0)
+        {}
+
+        int await_resume() const { _M_check(); return m_result_; }
+
+    private:
+        const void*   m_buffer_;
+        int           m_length_;
+        message_flags m_flags_;
+        int           m_result_;
+
+        bool _M_attempt() {
+            m_result_ = try_send(m_socket_, m_buffer_, m_length_,
+                m_flags_, &m_error_);
+            if (m_error_ != socket_error::WOULD_BLOCK) return true;
+            m_error_ = socket_error::SUCCESS;
+            return false;
+        }
+    };
+
+
+    class accept_awaiter : public io_awaiter {
+    public:
+        explicit accept_awaiter(basic_socket& __listener)
+        : io_awaiter(__listener.get(), (short)poll_flags::IN, false),
+          m_listener_(__listener), m_result_(-1)
+        {}
+
+        bool await_ready() {
+            /* accept() has no per-call non-blocking flag; a connection
+               reset after readiness, or another awaiter on the same
+               listener, would otherwise block the pipeline thread */
+            m_listener_.non_blocking(true);
+            return _M_attempt();
+        }
+
+        basic_socket await_resume() const {
+            _M_check();
+            auto peer = adopt_socket(m_result_, m_listener_.domain(),
+                m_listener_.type(), m_listener_.protocol());
+            /* some platforms pass the listener's mode on */
+            peer.non_blocking(false);
+            return peer;
+        }
+
+    private:
+        basic_socket& m_listener_;
+        int           m_result_;
+
+        bool _M_attempt() {
+            m_result_ = try_accept(m_socket_, &m_error_);
+            if (m_error_ != socket_error::WOULD_BLOCK) return true;
+            m_error_ = socket_error::SUCCESS;
+            return false;
+        }
+    };
+
+
+    class connect_awaiter : public io_awaiter {
+    public:
+        connect_awaiter(basic_socket& __socket,
+            const struct sockaddr* __address, size_t __length)
+        : io_awaiter(__socket.get(), (short)poll_flags::OUT, false),
+          m_target_(__socket), m_address_(__address), m_length_(__length)
+        {}
+
+        /* resolves the address up front; the result is owned here */
+        connect_awaiter(basic_socket& __socket, unsigned short __port,
+            const std::string& __address)
+        : io_awaiter(__socket.get(), (short)poll_flags::OUT, false),
+          m_target_(__socket)
+        {
+            m_length_ = fill_address(__socket.domain(), __socket.type(),
+                __socket.protocol(), __address, __port, &m_storage_);
+            m_address_ = m_storage_.get();
+        }
+
+        bool await_ready() {
+            m_target_.non_blocking(true);
+            m_error_ = try_connect(m_socket_, m_address_, m_length_);
+            if (m_error_ != socket_error::IN_PROGRESS) return true;
+            m_error_ = socket_error::SUCCESS;
+            return false;
+        }
+
+        void await_resume() const { _M_check(); }
+
+    private:
+        basic_socket&                    m_target_;
+        const struct sockaddr*           m_address_;
+        size_t                           m_length_;
+        std::shared_ptr<struct sockaddr> m_storage_;
+
+        bool _M_attempt() {
+            m_error_ = connect_result(m_socket_);
+            return true;
+        }
+    };
+
+
+    class sleep_awaiter : public async_timer {
+    public:
+        explicit sleep_awaiter(async_pipeline::clock::duration __duration)
+        : m_duration_(__duration)
+        {}
+
+        sleep_awaiter(const sleep_awaiter&) = delete;
+        sleep_awaiter& operator=(const sleep_awaiter&) = delete;
+
+        bool await_ready() const noexcept {
+            return m_duration_.count() <= 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> __handle) {
+            m_handle_           = __handle;
+            m_request_.type     = async_pipeline::command::action::ADD_TIMER;
+            m_request_.timer    = this;
+            m_request_.deadline = async_pipeline::clock::now() + m_duration_;
+            m_request_.owned    = false;
+            async_pipeline::instance().submit(&m_request_);
+        }
+
+        void await_resume() const noexcept {}
+
+        void on_timer() {
+            auto handle = m_handle_;
+            handle.resume();
+        }
+
+    private:
+        async_pipeline::clock::duration m_duration_;
+        std::coroutine_handle<>         m_handle_;
+        async_pipeline::command         m_request_;
+    };
+}
+
+    inline internal::recv_awaiter async_recv(basic_socket& socket,
+        void* buffer, int length, message_flags flags = message_flags::NONE)
+    { return internal::recv_awaiter(socket, buffer, length, flags); }
+
+    inline internal::send_awaiter async_send(basic_socket& socket,
+        const void* buffer, int length,
+        message_flags flags = message_flags::NONE)
+    { return internal::send_awaiter(socket, buffer, length, flags); }
+
+    inline internal::accept_awaiter async_accept(basic_socket& listener)
+    { return internal::accept_awaiter(listener); }
+
+    /* leaves the socket in non-blocking mode */
+    inline internal::connect_awaiter async_connect(basic_socket& socket,
+        const struct sockaddr* address, size_t length)
+    { return internal::connect_awaiter(socket, address, length); }
+
+    inline internal::connect_awaiter async_connect(basic_socket& socket,
+        unsigned short port, const std::string& address = "localhost")
+    { return internal::connect_awaiter(socket, port, address); }
+
+    template <class Rep, class Period>
+    internal::sleep_awaiter sleep_for(
+        const std::chrono::duration<Rep,Period>& duration)
+    {
+        return internal::sleep_awaiter(std::chrono::duration_cast<
+            internal::async_pipeline::clock::duration>(duration));
+    }
+}
+
+#endif /* __cpp_impl_coroutine */
+
+#endif
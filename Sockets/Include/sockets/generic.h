@@ -22,6 +22,7 @@ namespace impact {
 namespace internal {
     int error_code();
     std::string error_message();
+    std::string error_message(int code);
     
     size_t fill_address(address_family, socket_type, internet_protocol,
         const std::string& host, const unsigned short port,
@@ -0,0 +1,40 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_NONBLOCKING_H_
+#define _IMPACT_NONBLOCKING_H_
+
+#include <cstddef>
+
+#include "utils/environment.h"
+#include "sockets/types.h"
+
+#if defined(__OS_WINDOWS__)
+    #include <winsock2.h> // sockaddr
+#else
+    #include <sys/socket.h> // sockaddr
+#endif
+
+namespace impact {
+namespace internal {
+    /* Single attempts that never block the caller and never throw,
+       for the readiness-driven layers built on async_pipeline.
+       A result of -1 with socket_error::WOULD_BLOCK means: wait for
+       the socket to become ready, then try again. */
+    int try_recv(int socket, void* buffer, int length,
+        message_flags flags, socket_error* error) noexcept;
+    int try_send(int socket, const void* buffer, int length,
+        message_flags flags, socket_error* error) noexcept;
+    /* returns the accepted descriptor */
+    int try_accept(int socket, socket_error* error) noexcept;
+
+    /* SUCCESS, IN_PROGRESS (wait for OUT), or the failure reason;
+       the socket must already be in non-blocking mode */
+    socket_error try_connect(int socket, const struct sockaddr* address,
+        size_t length) noexcept;
+    /* outcome of an IN_PROGRESS connect once the socket is writable */
+    socket_error connect_result(int socket) noexcept;
+}}
+
+#endif
@@ -6,10 +6,20 @@
 #define _IMPACT_PROBE_H_
 
 #include <vector>
+#include <chrono>
+#include <unordered_map>
 
 #include "sockets/basic_socket.h"
 #include "sockets/types.h"
 
+#if !defined(__OS_WINDOWS__)
+    #include <signal.h> // sigset_t
+#endif
+
+#if defined(HAVE_EPOLL)
+    #include <sys/epoll.h>
+#endif
+
 namespace impact {
     typedef struct poll_handle {
         int   socket;
@@ -20,12 +30,84 @@ namespace impact {
     
     
     int select(
-        std::vector<basic_socket*> readHandles,
-        std::vector<basic_socket*> writeHandles,
-        int timeout=-1, unsigned int microTimeout=0);
+        const std::vector<basic_socket*>& readHandles,
+        const std::vector<basic_socket*>& writeHandles,
+        int timeout=-1, unsigned int microTimeout=0)
+        /* throw(impact_error) */;
+
+
+    int select(
+        const std::vector<basic_socket*>& readHandles,
+        const std::vector<basic_socket*>& writeHandles,
+        std::chrono::nanoseconds timeout)
+        /* throw(impact_error) */;
 
 
     int poll(std::vector<poll_handle>* handles, int timeout=-1);
+
+    /* negative timeouts block indefinitely; where ppoll is not available
+       the timeout is rounded up to the next millisecond */
+    int poll(std::vector<poll_handle>* handles,
+        std::chrono::nanoseconds timeout);
+#if !defined(__OS_WINDOWS__)
+    int poll(std::vector<poll_handle>* handles,
+        std::chrono::nanoseconds timeout, const sigset_t* sigmask);
+#endif
+
+
+    typedef struct probe_event {
+        int   socket;
+        short return_events;
+        void* data;
+    } ProbeEvent;
+
+
+    /* A persistent set of descriptors for applications
+       running their own event loop. Backed by epoll where
+       available and by poll() everywhere else. */
+    class probe_set {
+    public:
+        probe_set() /* throw(impact_error) */;
+        probe_set(const probe_set&) = delete;
+        probe_set& operator=(const probe_set&) = delete;
+        ~probe_set();
+
+        void add(int socket, short events, void* data = nullptr)
+            /* throw(impact_error) */;
+        void modify(int socket, short events, void* data = nullptr)
+            /* throw(impact_error) */;
+        void remove(int socket) /* throw(impact_error) */;
+        bool contains(int socket) const noexcept;
+        size_t size() const noexcept;
+
+        /* fills 'ready' with only the descriptors that have events;
+           returns -1 on error, 0 on timeout, or the number of events */
+        int wait(std::vector<probe_event>* ready, int timeout = -1);
+        int wait(std::vector<probe_event>* ready,
+            std::chrono::nanoseconds timeout);
+    #if !defined(__OS_WINDOWS__)
+        int wait(std::vector<probe_event>* ready,
+            std::chrono::nanoseconds timeout, const sigset_t* sigmask);
+    #endif
+
+    private:
+        struct entry {
+            int    socket;
+            short  events;
+            void*  data;
+            size_t index;
+        };
+
+        std::unordered_map<int,entry>   m_entries_;
+    #if defined(HAVE_EPOLL)
+        int                             m_descriptor_;
+        std::vector<struct epoll_event> m_events_;
+    #else
+        std::vector<poll_handle>        m_handles_;
+    #endif
+
+        int _M_collect(int status, std::vector<probe_event>* ready);
+    };
 }
 
 #endif
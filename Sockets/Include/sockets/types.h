@@ -57,6 +57,23 @@ namespace impact {
     } KeepAliveOptions;
 
 
+    /* Platform-neutral subset of TCP_INFO. Times are in microseconds,
+       windows in segments; fields the platform lacks are left at zero. */
+    typedef struct tcp_statistics {
+        int          state;                /* platform TCP state number    */
+        unsigned int rtt;                  /* smoothed round trip time     */
+        unsigned int rtt_variance;         /* round trip time mean dev.    */
+        unsigned int rto;                  /* retransmission timeout       */
+        unsigned int congestion_window;    /* send congestion window       */
+        unsigned int slow_start_threshold; /* send slow start threshold    */
+        unsigned int mss;                  /* send maximum segment size    */
+        unsigned int unacked;              /* segments in flight           */
+        unsigned int lost;                 /* segments presumed lost       */
+        unsigned int retransmits;          /* retransmitted segments, total */
+        tcp_statistics();
+    } TcpStatistics;
+
+
     typedef enum class group_application {
         JOIN  = IP_ADD_MEMBERSHIP,
         LEAVE = IP_DROP_MEMBERSHIP
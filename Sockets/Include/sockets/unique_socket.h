@@ -0,0 +1,86 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_UNIQUE_SOCKET_H_
+#define _IMPACT_UNIQUE_SOCKET_H_
+
+#include <string>
+#include <cstdint>
+
+#include "sockets/types.h"
+#include "sockets/basic_socket.h"
+
+namespace impact {
+    /* Move-only socket handle: a descriptor plus packed traits, with no
+       heap allocation and no reference counting. Closes on destruction.
+       Use share() to hand the descriptor over to a basic_socket. */
+    class unique_socket {
+    public:
+        enum {
+            INVALID = -1
+        };
+
+        unique_socket() noexcept;
+        unique_socket(const unique_socket&) = delete;
+        unique_socket(unique_socket&& r) noexcept;
+        ~unique_socket();
+
+        unique_socket& operator=(const unique_socket&) = delete;
+        unique_socket& operator=(unique_socket&& r) noexcept;
+
+        // observers
+        int get()                    const noexcept;
+        address_family domain()      const noexcept;
+        socket_type type()           const noexcept;
+        internet_protocol protocol() const noexcept;
+        explicit operator bool()     const noexcept;
+
+        // ownership
+        void close() /* throw(impact_error) */;
+        int release() noexcept;
+        basic_socket share() /* throw(impact_error) */;
+
+        // communication / delivery
+        void bind(unsigned short port) /* throw(impact_error) */;
+        void connect(unsigned short port,
+            const std::string& address = "localhost")
+            /* throw(impact_error) */;
+        void listen(int backlog = 5) /* throw(impact_error) */;
+        unique_socket accept() /* throw(impact_error) */;
+        void shutdown(socket_channel channel = socket_channel::BOTH)
+            /* throw(impact_error) */;
+        int send(const void* buffer, int length,
+            message_flags flags = message_flags::NONE)
+            /* throw(impact_error) */;
+        int recv(void* buffer, int length,
+            message_flags flags = message_flags::NONE)
+            /* throw(impact_error) */;
+
+        // miscillaneous
+        unsigned short local_port() /* throw(impact_error) */;
+        void non_blocking(bool enabled) /* throw(impact_error) */;
+
+        friend unique_socket make_unique_socket(
+            address_family, socket_type, internet_protocol);
+        friend unique_socket adopt_unique_socket(int,
+            address_family, socket_type, internet_protocol) noexcept;
+
+    private:
+        int           m_descriptor_;
+        std::uint32_t m_traits_; /* domain:8 | type:8 | protocol:16 */
+
+        static std::uint32_t _S_pack(address_family, socket_type,
+            internet_protocol) noexcept;
+    };
+
+    unique_socket make_unique_socket(address_family domain, socket_type type,
+        internet_protocol proto)          /* throw(impact_error) */;
+    unique_socket make_unique_tcp_socket() /* throw(impact_error) */;
+    unique_socket make_unique_udp_socket() /* throw(impact_error) */;
+    /* takes ownership of an already open descriptor */
+    unique_socket adopt_unique_socket(int descriptor, address_family domain,
+        socket_type type, internet_protocol proto) noexcept;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_CPU_FEATURES_H_
+#define _IMPACT_CPU_FEATURES_H_
+
+#include "utils/environment.h"
+
+namespace impact {
+namespace internal {
+    /* instruction set tiers the codecs ship kernels for */
+    typedef enum class simd_level {
+        SCALAR = 0, /* portable C++                         */
+        SSSE3,      /* 128-bit pshufb                       */
+        AVX2,       /* 256-bit integer                      */
+        AVX512,     /* AVX-512 F, BW and VBMI together      */
+        COUNT
+    } SimdLevel;
+
+
+    /* What cpuid reports, masked by what the operating system saves
+       on a context switch (XCR0). Everything reads false on non-x86
+       targets or when the compiler lacks HAVE_X86_SIMD support. */
+    struct cpu_features {
+        bool sse2;
+        bool ssse3;
+        bool sse41;
+        bool avx2;
+        bool avx512f;
+        bool avx512bw;
+        bool avx512vbmi;
+        bool sha;
+
+        cpu_features();
+    };
+
+
+    /* detected once per process */
+    const struct cpu_features& cpu() noexcept;
+
+    /* Highest level both this build and this CPU support. Setting
+       IMPACT_SIMD to scalar, ssse3, avx2 or avx512 in the environment
+       caps it, which is how the benchmarks compare kernels. */
+    simd_level simd() noexcept;
+
+    bool simd_supported(simd_level level) noexcept;
+    const char* simd_name(simd_level level) noexcept;
+}}
+
+#endif
@@ -19,6 +19,11 @@
     IMPACT_WIN_SECURE_REUSE: Enables 'exclusive address use'
     security for all sockets that need to reuse an address.
 
+    IMPACT_NO_METRICS: Compiles out all counter and histogram
+    recording (utils/metrics.h); snapshots then read as zero.
+    Set through the CMake option of the same name so the
+    library and its users agree.
+
 \* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 #if defined LITTLE_ENDIAN
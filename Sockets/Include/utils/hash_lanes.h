@@ -0,0 +1,35 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_HASH_LANES_H_
+#define _IMPACT_HASH_LANES_H_
+
+#include <cstddef>
+#include <string>
+
+#include "utils/cpu_features.h"
+
+/* Batch hashing shared by rfc/md5 and rfc/sha1; not part of the public
+   interface. Defined in rfc/hash_lanes.cpp. */
+
+namespace impact {
+namespace internal {
+    enum class lane_hash { MD5, SHA1 };
+
+    /* results receives count digests back to back; false when the
+       level has no lane kernel and the caller hashes one at a time */
+    bool hash_lanes(lane_hash algorithm, const void* const* data,
+        const size_t* lengths, size_t count, unsigned char* results,
+        simd_level level) noexcept;
+
+    typedef void (*batch_digest)(const void* const* data,
+        const size_t* lengths, size_t count, unsigned char* results);
+
+    /* hands strings to digest in slices large enough to keep every
+       lane busy */
+    void digest_strings(const std::string* messages, size_t count,
+        unsigned char* results, size_t hash_size, batch_digest digest);
+}}
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_METRICS_H_
+#define _IMPACT_METRICS_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#include "utils/environment.h"
+
+namespace impact {
+    typedef enum class metric_counter {
+        BYTES_SENT = 0,      /* payload accepted by send() / sendto()     */
+        BYTES_RECEIVED,      /* payload returned by recv() / recvfrom()   */
+        SEND_CALLS,          /* send-side system calls                    */
+        RECV_CALLS,          /* receive-side system calls                 */
+        WOULD_BLOCK,         /* calls that failed with EAGAIN/EWOULDBLOCK */
+        SOCKET_ERRORS,       /* calls that failed for any other reason    */
+        ACCEPTS,             /* accepted connections                      */
+        CONNECTS,            /* completed blocking connects               */
+        PIPELINE_ITERATIONS, /* async_pipeline poll loop iterations       */
+        PIPELINE_CALLBACKS,  /* async objects and batches dispatched      */
+        SLOW_CALLBACKS,      /* callbacks over the pipeline's threshold   */
+        STREAM_READS,        /* socketstream buffer refills               */
+        STREAM_WRITES,       /* socketstream buffer flushes               */
+        COUNT
+    } MetricCounter;
+
+
+    typedef enum class metric_histogram {
+        PIPELINE_LOOP = 0,   /* dispatch time of one loop iteration       */
+        PIPELINE_POLL,       /* time the loop spent waiting in poll       */
+        PIPELINE_CALLBACK,   /* time spent in one callback or batch       */
+        PIPELINE_LAG,        /* how late timers fire past their deadline  */
+        STREAM_WAIT,         /* socketstream wait for incoming data       */
+        COUNT
+    } MetricHistogram;
+
+
+    /* Log-linear buckets in the spirit of HdrHistogram: values below
+       2^k_sub_bits are exact, larger ones keep k_sub_bits bits of
+       mantissa (relative error under 1/2^k_sub_bits). Values are in
+       nanoseconds. */
+    struct histogram_snapshot {
+        static const unsigned int k_sub_bits = 4;
+        static const size_t k_buckets = (61 << k_sub_bits);
+
+        std::uint64_t              count;
+        std::uint64_t              sum;
+        std::uint64_t              min;
+        std::uint64_t              max;
+        std::vector<std::uint64_t> buckets;
+
+        histogram_snapshot();
+        /* upper bound of the bucket holding the given fraction (0..1) */
+        std::uint64_t percentile(double fraction) const noexcept;
+        double mean() const noexcept;
+
+        static size_t bucket_of(std::uint64_t value) noexcept;
+        static std::uint64_t bucket_low(size_t index) noexcept;
+        static std::uint64_t bucket_high(size_t index) noexcept;
+    };
+
+
+    struct metrics_snapshot {
+        std::uint64_t counters[(size_t)metric_counter::COUNT];
+        struct histogram_snapshot
+            histograms[(size_t)metric_histogram::COUNT];
+
+        metrics_snapshot();
+        std::uint64_t counter(metric_counter id) const noexcept;
+        const struct histogram_snapshot& histogram(metric_histogram id)
+            const noexcept;
+    };
+
+
+    /* Process-wide registry. Every thread writes to its own shard,
+       so recording never contends; snapshot() sums the shards. Build
+       with IMPACT_NO_METRICS to compile all recording out. */
+    class metrics {
+    public:
+        static void add(metric_counter id, std::uint64_t amount = 1) noexcept;
+        static void record(metric_histogram id, std::uint64_t nanoseconds)
+            noexcept;
+
+        static struct metrics_snapshot snapshot();
+        /* writes racing with reset() may survive it */
+        static void reset();
+
+        /* Prometheus text exposition format (version 0.0.4) */
+        static std::string prometheus();
+        static std::string prometheus(const struct metrics_snapshot& snapshot);
+
+        static const char* name(metric_counter id) noexcept;
+        static const char* name(metric_histogram id) noexcept;
+    };
+
+
+    /* records the lifetime of the scope into a histogram */
+    class metric_timer {
+    public:
+        explicit metric_timer(metric_histogram id) noexcept;
+        metric_timer(const metric_timer&) = delete;
+        metric_timer& operator=(const metric_timer&) = delete;
+        ~metric_timer();
+
+    private:
+#if !defined(IMPACT_NO_METRICS)
+        metric_histogram                      m_id_;
+        std::chrono::steady_clock::time_point m_start_;
+#endif
+    };
+
+namespace internal {
+    /* counts one system call and its outcome: bytes on success,
+       WOULD_BLOCK or SOCKET_ERRORS (read from errno) on failure */
+    void count_io(metric_counter calls, metric_counter bytes, long status)
+        noexcept;
+    void count_error() noexcept;
+}
+
+
+#if defined(IMPACT_NO_METRICS)
+    inline void metrics::add(metric_counter, std::uint64_t) noexcept {}
+    inline void metrics::record(metric_histogram, std::uint64_t) noexcept {}
+    inline metric_timer::metric_timer(metric_histogram) noexcept {}
+    inline metric_timer::~metric_timer() {}
+    inline void internal::count_io(metric_counter, metric_counter, long)
+        noexcept {}
+    inline void internal::count_error() noexcept {}
+#else
+    inline metric_timer::metric_timer(metric_histogram __id) noexcept
+    : m_id_(__id), m_start_(std::chrono::steady_clock::now())
+    {}
+
+    inline metric_timer::~metric_timer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_start_;
+        metrics::record(m_id_, (std::uint64_t)std::chrono::duration_cast<
+            std::chrono::nanoseconds>(elapsed).count());
+    }
+#endif
+}
+
+#endif
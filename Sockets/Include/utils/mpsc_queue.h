@@ -0,0 +1,74 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_MPSC_QUEUE_H_
+#define _IMPACT_MPSC_QUEUE_H_
+
+#include <atomic>
+
+namespace impact {
+namespace internal {
+    struct mpsc_node {
+        std::atomic<mpsc_node*> next;
+        mpsc_node() : next(nullptr) {}
+    };
+
+
+    /* Intrusive multi-producer single-consumer queue (Vyukov).
+       push() is wait-free for any thread; pop() and empty() may
+       only be called from the single consumer thread. Nodes are
+       owned by the caller; the queue never allocates. */
+    class mpsc_queue {
+    public:
+        mpsc_queue()
+        : m_head_(&m_stub_), m_tail_(&m_stub_)
+        {}
+
+        mpsc_queue(const mpsc_queue&) = delete;
+        mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+        void push(mpsc_node* __node) {
+            __node->next.store(nullptr, std::memory_order_relaxed);
+            auto previous = m_head_.exchange(__node, std::memory_order_acq_rel);
+            previous->next.store(__node, std::memory_order_release);
+        }
+
+        /* returns nullptr when empty or while a producer is mid-push */
+        mpsc_node* pop() {
+            auto tail = m_tail_;
+            auto next = tail->next.load(std::memory_order_acquire);
+            if (tail == &m_stub_) {
+                if (!next) return nullptr;
+                m_tail_ = next;
+                tail    = next;
+                next    = next->next.load(std::memory_order_acquire);
+            }
+            if (next) {
+                m_tail_ = next;
+                return tail;
+            }
+            if (tail != m_head_.load(std::memory_order_acquire))
+                return nullptr;
+            push(&m_stub_);
+            next = tail->next.load(std::memory_order_acquire);
+            if (next) {
+                m_tail_ = next;
+                return tail;
+            }
+            return nullptr;
+        }
+
+        bool empty() const {
+            return m_tail_ == &m_stub_ &&
+                m_stub_.next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        std::atomic<mpsc_node*> m_head_; /* producers */
+        mpsc_node*              m_tail_; /* consumer  */
+        mpsc_node               m_stub_;
+    };
+}}
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_THREAD_POOL_H_
+#define _IMPACT_THREAD_POOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <condition_variable>
+#include <functional>
+
+#include "utils/environment.h"
+
+namespace impact {
+namespace internal {
+    /* Work-stealing pool: every worker owns a Chase-Lev deque,
+       external submissions go through a shared injection queue,
+       and idle workers park until new work is published. */
+    class thread_pool {
+    public:
+        typedef std::function<void()> task;
+
+        typedef struct options {
+            unsigned int threads;     /* 0: std::thread::hardware_concurrency */
+            bool         pin_threads; /* bind worker N to CPU (first_cpu + N) */
+            unsigned int first_cpu;
+            options();
+        } Options;
+
+        explicit thread_pool(struct options opts = options());
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+        ~thread_pool();
+
+        void submit(task work) /* throw(impact_error) */;
+        size_t size() const noexcept;
+        bool in_pool() const noexcept;
+
+    private:
+        class work_deque {
+        public:
+            work_deque();
+            ~work_deque();
+            void  push(task* work);  /* owner only */
+            task* take();            /* owner only */
+            task* steal();           /* any thread */
+            bool  empty() const noexcept;
+
+        private:
+            struct ring {
+                long long                       capacity;
+                std::unique_ptr<std::atomic<task*>[]> buffer;
+                explicit ring(long long capacity);
+                task* get(long long index) const noexcept;
+                void  put(long long index, task* work) noexcept;
+            };
+
+            std::atomic<long long>             m_top_;
+            std::atomic<long long>             m_bottom_;
+            std::atomic<ring*>                 m_ring_;
+            std::vector<std::unique_ptr<ring>> m_retired_;
+
+            ring* _M_grow(ring* current, long long bottom, long long top);
+        };
+
+        class parker {
+        public:
+            parker();
+            void park();
+            void unpark();
+
+        private:
+            std::atomic<int>        m_state_; /* -1 parked, 0 empty, 1 notified */
+        #if !defined(__OS_LINUX__)
+            std::mutex              m_mtx_;
+            std::condition_variable m_cv_;
+        #endif
+        };
+
+        struct worker {
+            work_deque        deque;
+            parker            park;
+            std::atomic<bool> idle;
+            std::thread       thread;
+            unsigned int      seed;
+        };
+
+        std::vector<std::unique_ptr<worker>> m_workers_;
+        std::mutex                           m_inject_mtx_;
+        std::deque<task*>                    m_injected_;
+        std::atomic<size_t>                  m_injected_size_;
+        std::atomic<int>                     m_sleeping_;
+        std::atomic<bool>                    m_shutting_down_;
+
+        void  _M_run(size_t index);
+        task* _M_find_work(size_t index);
+        task* _M_pop_injected();
+        bool  _M_has_visible_work() const;
+        void  _M_wake_one();
+        void  _M_pin(size_t index, unsigned int cpu);
+    };
+}}
+
+#endif
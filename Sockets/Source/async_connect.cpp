@@ -0,0 +1,324 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "sockets/async_connect.h"
+
+#include <vector>
+#include <memory>
+#include <cstring>
+
+#include "utils/environment.h"
+#include "utils/impact_error.h"
+#include "sockets/generic.h"
+#include "sockets/nonblocking.h"
+#include "sockets/async_pipeline.h"
+
+#if defined(__OS_WINDOWS__)
+    #include <ws2tcpip.h>   // getaddrinfo()
+#else
+    #include <sys/socket.h> // sockaddr_storage
+    #include <netdb.h>      // getaddrinfo()
+#endif
+
+using namespace impact;
+using namespace internal;
+
+namespace impact {
+namespace internal {
+    class eyeballs_race;
+
+    struct eyeballs_candidate {
+        address_family          domain;
+        struct sockaddr_storage address;
+        size_t                  length;
+    };
+
+
+    struct eyeballs_attempt : public async_object {
+        std::shared_ptr<eyeballs_race> owner;
+        basic_socket                   socket;
+        async_option async_callback(poll_handle*, socket_error);
+    };
+
+
+    class eyeballs_race : public std::enable_shared_from_this<eyeballs_race> {
+    public:
+        eyeballs_race(connect_callback, async_pipeline::clock::duration);
+
+        void resolve(const std::string& host, unsigned short port);
+        async_option attempt_ready(eyeballs_attempt*, short return_events);
+
+        std::shared_ptr<eyeballs_race> self;
+        async_pipeline::clock::time_point deadline;
+
+    private:
+        /* trampolines for the three pipeline timers */
+        struct hook : public async_timer {
+            eyeballs_race* owner;
+            void (eyeballs_race::*action)();
+            bool armed;
+            void on_timer();
+        };
+
+        connect_callback                  m_callback_;
+        async_pipeline::clock::duration   m_attempt_delay_;
+        std::vector<eyeballs_candidate>   m_candidates_;
+        size_t                            m_next_;
+        std::vector<std::shared_ptr<eyeballs_attempt>> m_attempts_;
+        socket_error                      m_last_error_;
+        bool                              m_done_;
+        hook                              m_start_;
+        hook                              m_stagger_;
+        hook                              m_expiry_;
+
+        void _M_start();
+        void _M_next_attempt();
+        void _M_expire();
+        void _M_arm(hook*, async_pipeline::clock::time_point);
+        void _M_disarm(hook*);
+        void _M_finish(basic_socket, socket_error);
+    };
+}}
+
+
+void
+impact::async_connect(
+    const std::string&        __host,
+    unsigned short            __port,
+    std::chrono::milliseconds __timeout,
+    connect_callback          __callback,
+    std::chrono::milliseconds __attempt_delay)
+{
+    if (!__callback)
+        throw impact_error("Invalid callback");
+
+    auto race = std::make_shared<eyeballs_race>(__callback, __attempt_delay);
+    race->deadline = async_pipeline::clock::now() + __timeout;
+    race->self     = race;
+    /* getaddrinfo() blocks; keep it off both the caller and the loop */
+    std::string host = __host;
+    async_pipeline::instance().offload([race, host, __port]() {
+        race->resolve(host, __port);
+    });
+}
+
+
+eyeballs_race::eyeballs_race(
+    connect_callback                __callback,
+    async_pipeline::clock::duration __attempt_delay)
+: m_callback_(__callback), m_attempt_delay_(__attempt_delay), m_next_(0),
+  m_last_error_(socket_error::OTHER), m_done_(false)
+{
+    hook* hooks[] = { &m_start_, &m_stagger_, &m_expiry_ };
+    for (auto target : hooks) {
+        target->owner = this;
+        target->armed = false;
+    }
+    m_start_.action   = &eyeballs_race::_M_start;
+    m_stagger_.action = &eyeballs_race::_M_next_attempt;
+    m_expiry_.action  = &eyeballs_race::_M_expire;
+}
+
+
+void
+eyeballs_race::resolve(
+    const std::string& __host,
+    unsigned short     __port)
+{
+    struct addrinfo hints;
+    ::memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    struct addrinfo* results = NULL;
+    auto service = std::to_string(__port);
+    auto status  = ::getaddrinfo(__host.c_str(), service.c_str(),
+        &hints, &results);
+
+    if (status == 0) {
+        /* RFC 8305 section 4: alternate families, starting with
+           whichever the resolver preferred */
+        std::vector<eyeballs_candidate> inet6, inet;
+        for (auto current = results; current; current = current->ai_next) {
+            if (current->ai_family != AF_INET6 && current->ai_family != AF_INET)
+                continue;
+            eyeballs_candidate candidate;
+            candidate.domain = (address_family)current->ai_family;
+            candidate.length = current->ai_addrlen;
+            ::memcpy(&candidate.address, current->ai_addr,
+                current->ai_addrlen);
+            if (current->ai_family == AF_INET6)
+                 inet6.push_back(candidate);
+            else inet.push_back(candidate);
+        }
+        auto& first  = results->ai_family == AF_INET ? inet  : inet6;
+        auto& second = results->ai_family == AF_INET ? inet6 : inet;
+        for (size_t i = 0; i < first.size() || i < second.size(); i++) {
+            if (i < first.size())  m_candidates_.push_back(first[i]);
+            if (i < second.size()) m_candidates_.push_back(second[i]);
+        }
+        ::freeaddrinfo(results);
+    }
+
+    /* everything past this point happens on the pipeline thread */
+    _M_arm(&m_start_, async_pipeline::clock::now());
+}
+
+
+void
+eyeballs_race::_M_start()
+{
+    _M_arm(&m_expiry_, deadline);
+    _M_next_attempt();
+}
+
+
+void
+eyeballs_race::_M_next_attempt()
+{
+    auto& pipeline = async_pipeline::instance();
+    _M_disarm(&m_stagger_);
+
+    while (!m_done_ && m_next_ < m_candidates_.size()) {
+        const auto& target = m_candidates_[m_next_++];
+        basic_socket socket;
+        try {
+            socket = make_socket(target.domain, socket_type::STREAM,
+                internet_protocol::TCP);
+            socket.non_blocking(true);
+        }
+        catch (impact_error&) {
+            m_last_error_ = (socket_error)error_code();
+            continue;
+        }
+
+        auto status = try_connect(socket.get(),
+            (const struct sockaddr*)&target.address, target.length);
+        if (status == socket_error::SUCCESS) {
+            _M_finish(socket, status);
+            return;
+        }
+        if (status != socket_error::IN_PROGRESS) {
+            m_last_error_ = status;
+            continue; /* 'socket' closes as it goes out of scope */
+        }
+
+        auto attempt    = std::make_shared<eyeballs_attempt>();
+        attempt->owner  = shared_from_this();
+        attempt->socket = socket;
+        m_attempts_.push_back(attempt);
+        pipeline.add_object(socket.get(), attempt, (short)poll_flags::OUT);
+
+        if (m_next_ < m_candidates_.size())
+            _M_arm(&m_stagger_, async_pipeline::clock::now() + m_attempt_delay_);
+        return;
+    }
+
+    if (!m_done_ && m_attempts_.empty())
+        _M_finish(basic_socket(), m_last_error_);
+}
+
+
+async_option
+eyeballs_race::attempt_ready(
+    eyeballs_attempt* __attempt,
+    short             __return_events)
+{
+    if (m_done_) return async_option::QUIT;
+    /* notify() dispatches every handle, ready or not */
+    if (__return_events == 0) return async_option::CONTINUE;
+
+    auto status = connect_result(__attempt->socket.get());
+    for (auto target = m_attempts_.begin(); target != m_attempts_.end(); target++) {
+        if (target->get() == __attempt) {
+            m_attempts_.erase(target);
+            break;
+        }
+    }
+
+    if (status == socket_error::SUCCESS)
+        _M_finish(__attempt->socket, status);
+    else {
+        m_last_error_ = status;
+        try { __attempt->socket.close(); } catch (...) { }
+        /* a failure starts the next candidate right away */
+        _M_next_attempt();
+    }
+    return async_option::QUIT;
+}
+
+
+void
+eyeballs_race::_M_expire()
+{
+    _M_finish(basic_socket(), socket_error::TIMED_OUT);
+}
+
+
+void
+eyeballs_race::_M_arm(
+    hook*                             __target,
+    async_pipeline::clock::time_point __when)
+{
+    __target->armed = true;
+    async_pipeline::instance().add_timer(__target, __when);
+}
+
+
+void
+eyeballs_race::_M_disarm(hook* __target)
+{
+    if (!__target->armed) return;
+    __target->armed = false;
+    async_pipeline::instance().cancel_timer(__target);
+}
+
+
+void
+eyeballs_race::_M_finish(
+    basic_socket __socket,
+    socket_error __error)
+{
+    if (m_done_) return;
+    m_done_ = true;
+    /* may hold the last reference; release it on the way out */
+    auto keep_alive = std::move(self);
+
+    auto& pipeline = async_pipeline::instance();
+    _M_disarm(&m_stagger_);
+    _M_disarm(&m_expiry_);
+    for (auto& loser : m_attempts_) {
+        pipeline.remove_object(loser->socket.get());
+        try { loser->socket.close(); } catch (...) { }
+    }
+    m_attempts_.clear();
+
+    if (__socket) {
+        try { __socket.non_blocking(false); }
+        catch (impact_error&) { __error = (socket_error)error_code(); }
+    }
+    if (__error != socket_error::SUCCESS)
+        __socket = basic_socket();
+    m_callback_(__socket, __error);
+}
+
+
+void
+eyeballs_race::hook::on_timer()
+{
+    armed = false;
+    (owner->*action)();
+}
+
+
+async_option
+eyeballs_attempt::async_callback(
+    poll_handle* __handle,
+    socket_error __error)
+{
+    if (__error != socket_error::SUCCESS)
+        return async_option::CONTINUE; /* poll() itself failed */
+    return owner->attempt_ready(this, __handle->return_events);
+}
@@ -8,8 +8,13 @@
 #include <algorithm>
 #include <chrono>
 
+#if defined(__GNUG__)
+    #include <cxxabi.h>
+#endif
+
 #include "utils/environment.h"
 #include "utils/impact_error.h"
+#include "utils/metrics.h"
 #include "sockets/types.h"
 #include "sockets/generic.h"
 
@@ -19,6 +24,11 @@ using namespace internal;
 #include <iostream>
 #define VERB(x) std::cout << x << std::endl
 
+namespace impact {
+namespace internal {
+    bool is_armed(const poll_handle& handle);
+}}
+
 
 async_pipeline&
 async_pipeline::instance()
@@ -34,7 +44,11 @@ async_pipeline::async_pipeline()
     m_thread_ready_     = false;
     m_thread_closing_   = false;
     m_thread_has_work_  = false;
-    m_thread_pending_   = 0;
+    m_thread_sleeping_  = false;
+    m_thread_notified_  = false;
+    m_thread_id_        = std::thread::id();
+    m_pool_ptr_         = nullptr;
+    m_slow_threshold_   = 0;
     // m_main_ready_       = false;
 
     _M_begin();
@@ -44,6 +58,11 @@ async_pipeline::async_pipeline()
 async_pipeline::~async_pipeline()
 {
     _M_end();
+    /* release anything submitted after the last iteration */
+    while (auto node = m_commands_.pop()) {
+        auto request = static_cast<command*>(node);
+        if (request->owned) delete request;
+    }
 }
 
 
@@ -59,16 +78,36 @@ async_pipeline::granularity(int __milliseconds)
 void
 async_pipeline::add_object(
     int              __socket,
-    async_object_ptr __object)
+    async_object_ptr __object,
+    short            __events)
 {
     if (__socket < 0)
         throw impact_error("Invalid socket");
 
-    {
-        std::lock_guard<std::mutex> lock(m_work_mtx_);
-        m_work_pending_.push_back(handle_info(__socket,__object));
-    }
-    _M_notify_pending(1);
+    auto request    = new command();
+    request->type   = command::action::ADD;
+    request->socket = __socket;
+    request->events = __events;
+    request->object = __object;
+    submit(request);
+}
+
+
+void
+async_pipeline::add_object(
+    int             __socket,
+    async_batch_ptr __object,
+    short           __events)
+{
+    if (__socket < 0)
+        throw impact_error("Invalid socket");
+
+    auto request    = new command();
+    request->type   = command::action::ADD;
+    request->socket = __socket;
+    request->events = __events;
+    request->batch  = __object;
+    submit(request);
 }
 
 
@@ -78,150 +117,515 @@ async_pipeline::remove_object(int __socket)
     if (__socket < 0)
         throw impact_error("Invalid socket");
 
-    {
-        std::lock_guard<std::mutex> lock(m_work_mtx_);
-        m_work_removed_.push_back(__socket);
+    auto request    = new command();
+    request->type   = command::action::REMOVE;
+    request->socket = __socket;
+    submit(request);
+}
+
+
+void
+async_pipeline::notify()
+{
+    m_thread_notified_ = true;
+    m_thread_has_work_ = true;
+    _M_wake();
+}
+
+
+void
+async_pipeline::add_timer(
+    async_timer*      __timer,
+    clock::time_point __deadline)
+{
+    if (!__timer)
+        throw impact_error("Invalid timer");
+
+    if (in_pipeline()) {
+        _M_add_timer(__timer, __deadline);
+        return;
     }
-    _M_notify_pending(1);
+    auto request      = new command();
+    request->type     = command::action::ADD_TIMER;
+    request->timer    = __timer;
+    request->deadline = __deadline;
+    submit(request);
 }
 
 
 void
-async_pipeline::_M_notify_pending(int p)
+async_pipeline::cancel_timer(async_timer* __timer)
 {
-    {
-        std::lock_guard<std::mutex> lock(m_thread_mtx_);
-        m_thread_pending_ += p;
+    if (!__timer)
+        throw impact_error("Invalid timer");
+
+    /* on the pipeline thread this must take effect before the
+       next expiry check, so it can't wait for the command queue */
+    if (in_pipeline()) {
+        _M_cancel_timer(__timer);
+        return;
     }
-    m_thread_cv_.notify_one();
+    auto request   = new command();
+    request->type  = command::action::CANCEL_TIMER;
+    request->timer = __timer;
+    submit(request);
+}
+
+
+bool
+async_pipeline::in_pipeline() const noexcept
+{
+    return std::this_thread::get_id() == m_thread_id_.load();
 }
 
 
 void
-async_pipeline::notify()
+async_pipeline::submit(command* __request)
 {
-    {
-        std::lock_guard<std::mutex> lock(m_thread_mtx_);
-        m_thread_has_work_ = true;
+    if (!__request)
+        throw impact_error("Invalid request");
+    m_commands_.push(__request);
+    _M_wake();
+}
+
+
+void
+async_pipeline::_M_wake()
+{
+    /* pairs with the fence in _M_begin: either the pipeline thread
+       sees the new request or we see that it went to sleep */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_thread_sleeping_) {
+        { std::lock_guard<std::mutex> lock(m_thread_mtx_); }
+        m_thread_cv_.notify_one();
     }
-    m_thread_cv_.notify_one();
 }
 
 
 void
-async_pipeline::_M_copy_pending_to_queue()
-{
-    for (auto& token : m_work_pending_) {
-        auto target_info = m_work_info_.find(token.first);
-        if (target_info == m_work_info_.end()) {
-            m_work_info_[token.first] = token.second;
-            struct poll_handle handle;
-            handle.socket = token.first;
-            handle.events = (short)poll_flags::IN;
-            m_work_handles_.push_back(handle);
-        }
-        else
-            target_info->second = token.second;
+async_pipeline::offload(std::function<void()> __task)
+{
+    auto pool = m_pool_ptr_.load(std::memory_order_acquire);
+    if (!pool) {
+        std::lock_guard<std::mutex> lock(m_pool_mtx_);
+        if (!m_pool_)
+            m_pool_.reset(new thread_pool(m_pool_options_));
+        pool = m_pool_.get();
+        m_pool_ptr_.store(pool, std::memory_order_release);
     }
-    m_work_pending_.clear();
+    pool->submit(std::move(__task));
 }
 
 
 void
-async_pipeline::_M_remove_pending_from_queue()
-{
-    for (auto& token : m_work_removed_) {
-        auto handle = std::find_if(
-            m_work_handles_.begin(),
-            m_work_handles_.end(),
-            [&](const poll_handle& __handle) -> bool {
-                return std::abs(__handle.socket) == token;
-            }
-        );
-        if (handle != m_work_handles_.end()) {
-            // for every handle there is associated info - remove both
-            m_work_info_.erase(m_work_info_.find(std::abs(handle->socket)));
-            m_work_handles_.erase(handle);
-        }
+async_pipeline::pool_options(const thread_pool::options& __options)
+{
+    std::lock_guard<std::mutex> lock(m_pool_mtx_);
+    if (m_pool_)
+        throw impact_error("Thread pool already running");
+    m_pool_options_ = __options;
+}
+
+
+void
+async_pipeline::slow_callback_threshold(
+    std::chrono::nanoseconds __threshold,
+    slow_handler             __handler)
+{
+    std::lock_guard<std::mutex> lock(m_slow_mtx_);
+    m_slow_handler_   = __handler;
+    m_slow_threshold_ = __threshold.count() > 0 ? __threshold.count() : 0;
+}
+
+
+void
+async_pipeline::_M_drain_commands()
+{
+    /* requests are applied in submission order */
+    while (auto node = m_commands_.pop())
+        _M_apply(static_cast<command*>(node));
+}
+
+
+void
+async_pipeline::_M_apply(command* __request)
+{
+    switch (__request->type) {
+    case command::action::ADD:
+        _M_add_handle(__request->socket, __request->events,
+            __request->object, __request->batch);
+        break;
+    case command::action::REMOVE:
+        _M_remove_handle(__request->socket);
+        break;
+    case command::action::ADD_TIMER:
+        _M_add_timer(__request->timer, __request->deadline);
+        break;
+    case command::action::CANCEL_TIMER:
+        _M_cancel_timer(__request->timer);
+        break;
     }
-    m_work_removed_.clear();
+    /* caller-owned requests may be reused as soon as this returns */
+    if (__request->owned) delete __request;
+}
+
+
+void
+async_pipeline::_M_add_handle(
+    int              __socket,
+    short            __events,
+    async_object_ptr __object,
+    async_batch_ptr  __batch)
+{
+    auto target = m_work_index_.find(__socket);
+    if (target == m_work_index_.end()) {
+        m_work_index_[__socket] = m_work_handles_.size();
+        struct poll_handle handle;
+        handle.socket = __socket;
+        m_work_handles_.push_back(handle);
+        m_work_info_.push_back(handle_info());
+        target = m_work_index_.find(__socket);
+    }
+    auto& key   = m_work_handles_[target->second];
+    auto& info  = m_work_info_[target->second];
+    info.object = __object;
+    info.batch  = __batch;
+    info.events = __events;
+    /* a new registration always starts armed */
+    key.socket  = __socket;
+    key.events  = __events;
+}
+
+
+void
+async_pipeline::_M_remove_handle(int __socket)
+{
+    auto target = m_work_index_.find(__socket);
+    if (target != m_work_index_.end())
+        _M_erase_slot(target->second);
+}
+
+
+void
+async_pipeline::_M_erase_slot(size_t __slot)
+{
+    /* swap-remove: move the last entry into the vacated slot */
+    m_work_index_.erase(std::abs(m_work_handles_[__slot].socket));
+    auto last = m_work_handles_.size() - 1;
+    if (__slot != last) {
+        m_work_handles_[__slot] = m_work_handles_[last];
+        m_work_info_[__slot]    = std::move(m_work_info_[last]);
+        m_work_index_[std::abs(m_work_handles_[__slot].socket)] = __slot;
+    }
+    m_work_handles_.pop_back();
+    m_work_info_.pop_back();
+}
+
+
+void
+async_pipeline::_M_dispatch_batches(socket_error __error)
+{
+    /* m_batch_slots_ holds positions into m_ready_; group them
+       by owner so every batch object is called exactly once */
+    if (m_batch_slots_.empty()) return;
+    std::stable_sort(m_batch_slots_.begin(), m_batch_slots_.end(),
+        [&](size_t __lhs, size_t __rhs) -> bool {
+            return m_work_info_[m_ready_[__lhs]].batch.get() <
+                m_work_info_[m_ready_[__rhs]].batch.get();
+        });
+
+    m_batch_events_.clear();
+    for (auto position : m_batch_slots_) {
+        struct ready_event event;
+        event.handle = &m_work_handles_[m_ready_[position]];
+        event.error  = __error;
+        event.option = async_option::CONTINUE;
+        m_batch_events_.push_back(event);
+    }
+
+    size_t first = 0;
+    while (first < m_batch_slots_.size()) {
+        auto owner = m_work_info_[m_ready_[m_batch_slots_[first]]].batch;
+        auto last  = first + 1;
+        while (last < m_batch_slots_.size() &&
+            m_work_info_[m_ready_[m_batch_slots_[last]]].batch == owner)
+            last++;
+        auto socket = std::abs(m_batch_events_[first].handle->socket);
+        auto start  = _M_profile_begin();
+        owner->on_ready(&m_batch_events_[first], last - first);
+        _M_profile_end(start, socket, last - first, typeid(*owner));
+        first = last;
+    }
+
+    for (size_t i = 0; i < m_batch_slots_.size(); i++)
+        m_ready_options_[m_batch_slots_[i]] = m_batch_events_[i].option;
 }
 
 
 bool
-async_pipeline::_M_update_handles()
+async_pipeline::_M_update_handles(int __status)
 {
-    size_t ignored = 0;
-    auto error = (socket_error)error_code();
-    for (size_t i = 0; /* (!m_thread_closing_) && */
-        (i < m_work_handles_.size()); i++) {
-        auto& key   = m_work_handles_[i];
-        auto socket = std::abs(key.socket);
-        auto value  = m_work_info_.find(socket);
+    /* a notify() re-arms ignored handles and dispatches everything */
+    auto tick = m_thread_notified_.exchange(false);
+    auto error = socket_error::SUCCESS;
+    if (__status < 0) {
+        error = (socket_error)error_code();
+        /* a stray signal is not an I/O error: poll again, or dispatch
+           the pending notify() as a plain tick */
+        if (error == socket_error::INTERRUPTED) {
+            if (!tick) return false;
+            error = socket_error::SUCCESS;
+        }
+    }
+    auto all = tick || __status < 0;
+
+    m_ready_.clear();
+    m_batch_slots_.clear();
+    for (size_t i = 0; i < m_work_handles_.size(); i++) {
+        if (all || (is_armed(m_work_handles_[i]) &&
+            m_work_handles_[i].return_events != 0))
+            m_ready_.push_back(i);
+    }
 
-        auto option = value->second->async_callback(&key,error);
+    m_ready_options_.assign(m_ready_.size(), async_option::CONTINUE);
+    for (size_t i = 0; i < m_ready_.size(); i++) {
+        auto slot  = m_ready_[i];
+        auto& info = m_work_info_[slot];
+        if (info.batch)
+            m_batch_slots_.push_back(i);
+        else if (info.object) {
+            auto socket      = std::abs(m_work_handles_[slot].socket);
+            const auto& type = typeid(*info.object);
+            auto start       = _M_profile_begin();
+            m_ready_options_[i] =
+                info.object->async_callback(&m_work_handles_[slot], error);
+            _M_profile_end(start, socket, 1, type);
+        }
+        else m_ready_options_[i] = async_option::QUIT;
+    }
+    _M_dispatch_batches(error);
 
-        switch (option) {
+    /* descending, so swap-removal never moves an unvisited slot */
+    for (size_t i = m_ready_.size(); i-- > 0;) {
+        auto slot   = m_ready_[i];
+        auto& key   = m_work_handles_[slot];
+        auto events = m_work_info_[slot].events;
+        auto socket = std::abs(key.socket);
+        switch (m_ready_options_[i]) {
         case async_option::IGNORE:
-            socket            = -socket;
-            /* special 0-fd case */
-            if (socket == 0) ignored++;
-        FALLTHROUGH;
-        case async_option::CONTINUE:
+            /* fd 0 can't be negated and stays polled;
+               its events are masked instead */
+            key.socket        = -socket;
+            key.events        = socket == 0 ? 0 : events;
             key.return_events = 0;
+            break;
+        case async_option::CONTINUE:
             key.socket        = socket;
-            if (socket < 0) ignored++;
+            key.events        = events;
+            key.return_events = 0;
             break;
         default: /* async_option::QUIT */
-            m_work_handles_.erase(m_work_handles_.begin()+i);
-            m_work_info_.erase(value);
-            i--;
+            _M_erase_slot(slot);
             break;
         }
     }
-    return ignored == m_work_handles_.size();
+
+    for (const auto& key : m_work_handles_) {
+        if (is_armed(key)) return false;
+    }
+    return true;
+}
+
+
+bool
+internal::is_armed(const poll_handle& __handle)
+{
+    /* ignored handles are negated, except fd 0 which is masked */
+    return __handle.socket > 0 ||
+        (__handle.socket == 0 && __handle.events != 0);
 }
 
 
 void
 async_pipeline::_M_dowork()
 {
-    int pending_satisfied = 0;
-    { /* worker locked scope */
-        std::lock_guard<std::mutex> lock(m_work_mtx_);
-        pending_satisfied += m_work_pending_.size();
-        pending_satisfied += m_work_removed_.size();
-        _M_copy_pending_to_queue();
-        _M_remove_pending_from_queue();
-    } /* end locked scope */
+    _M_drain_commands();
 
-    auto status = poll(&m_work_handles_, (int)m_poll_granularity_);
-    UNUSED(status);
+    /* a pending notify() shouldn't wait out the granularity */
+    auto timeout = m_thread_notified_ ? 0 : (int)m_poll_granularity_;
+    int status;
+    {
+        metric_timer timer(metric_histogram::PIPELINE_POLL);
+        status = poll(&m_work_handles_, _M_timer_timeout(timeout));
+    }
 
-    auto has_work = !_M_update_handles();
+    /* measures dispatch only; time spent waiting in poll is idle */
+    metric_timer timer(metric_histogram::PIPELINE_LOOP);
+    metrics::add(metric_counter::PIPELINE_ITERATIONS);
+    auto idle = _M_update_handles(status);
+    _M_fire_timers();
+    m_thread_has_work_ = !idle || !m_timers_.empty();
+}
 
-    { /* thread locked scope */
-        std::lock_guard<std::mutex> lock(m_thread_mtx_);
-        m_thread_has_work_ = has_work; // <- *
-        m_thread_pending_ -= pending_satisfied;
-    } /* end locked scope */
+
+void
+async_pipeline::_M_add_timer(
+    async_timer*      __timer,
+    clock::time_point __deadline)
+{
+    timer_info info;
+    info.deadline = __deadline;
+    info.timer    = __timer;
+    m_timers_.push_back(info);
+    std::push_heap(m_timers_.begin(), m_timers_.end(),
+        std::greater<timer_info>());
 }
 
 
+void
+async_pipeline::_M_cancel_timer(async_timer* __timer)
+{
+    auto target = std::find_if(m_timers_.begin(), m_timers_.end(),
+        [&](const timer_info& __info) -> bool {
+            return __info.timer == __timer;
+        });
+    if (target == m_timers_.end()) return;
+    m_timers_.erase(target);
+    std::make_heap(m_timers_.begin(), m_timers_.end(),
+        std::greater<timer_info>());
+}
+
+
+int
+async_pipeline::_M_timer_timeout(int __timeout)
+{
+    if (m_timers_.empty()) return __timeout;
+    auto remaining = m_timers_.front().deadline - clock::now();
+    if (remaining.count() <= 0) return 0;
+    /* round up so a timer is never polled for early */
+    auto milliseconds = std::chrono::duration_cast<
+        std::chrono::milliseconds>(remaining).count() + 1;
+    if (__timeout < 0 || milliseconds < __timeout)
+        return (int)milliseconds;
+    return __timeout;
+}
+
+
+void
+async_pipeline::_M_fire_timers()
+{
+    auto now = clock::now();
+    while (!m_timers_.empty() && m_timers_.front().deadline <= now) {
+        std::pop_heap(m_timers_.begin(), m_timers_.end(),
+            std::greater<timer_info>());
+        auto timer = m_timers_.back().timer;
+        metrics::record(metric_histogram::PIPELINE_LAG,
+            (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now - m_timers_.back().deadline).count());
+        m_timers_.pop_back();
+        /* may add or cancel timers; the heap is consistent again */
+        /* a timer may free itself once it has fired */
+        const auto& type = typeid(*timer);
+        auto start = _M_profile_begin();
+        timer->on_timer();
+        _M_profile_end(start, -1, 0, type);
+    }
+}
+
+
+async_pipeline::clock::time_point
+async_pipeline::_M_profile_begin() const noexcept
+{
+#if defined(IMPACT_NO_METRICS)
+    /* nothing to record; only read the clock for slow detection */
+    if (m_slow_threshold_.load(std::memory_order_relaxed) == 0)
+        return clock::time_point();
+#endif
+    return clock::now();
+}
+
+
+void
+async_pipeline::_M_profile_end(
+    clock::time_point     __start,
+    int                   __socket,
+    size_t                __handles,
+    const std::type_info& __type)
+{
+    metrics::add(metric_counter::PIPELINE_CALLBACKS);
+    if (__start == clock::time_point()) return;
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        clock::now() - __start);
+    metrics::record(metric_histogram::PIPELINE_CALLBACK,
+        (std::uint64_t)elapsed.count());
+
+    auto threshold = m_slow_threshold_.load(std::memory_order_relaxed);
+    if (threshold == 0 || elapsed.count() < threshold) return;
+    metrics::add(metric_counter::SLOW_CALLBACKS);
+
+    struct slow_callback report;
+    report.socket  = __socket;
+    report.handles = __handles;
+    report.type    = &__type;
+    report.elapsed = elapsed;
+
+    slow_handler handler;
+    {
+        std::lock_guard<std::mutex> lock(m_slow_mtx_);
+        handler = m_slow_handler_;
+    }
+    if (handler) {
+        handler(report);
+        return;
+    }
+
+    std::string name = __type.name();
+#if defined(__GNUG__)
+    int demangled = 0;
+    auto readable = abi::__cxa_demangle(name.c_str(), NULL, NULL, &demangled);
+    if (demangled == 0 && readable) name = readable;
+    std::free(readable);
+#endif
+    std::cerr << "[async_pipeline] slow callback: " << name <<
+        " (socket " << __socket << ") took " <<
+        elapsed.count() / 1000 << " us" << std::endl;
+}
+
+
+bool
+async_pipeline::timer_info::operator>(const timer_info& __rhs) const noexcept
+{
+    return deadline > __rhs.deadline;
+}
+
+
+async_pipeline::command::command()
+: type(action::ADD), socket(-1), events((short)poll_flags::IN),
+  timer(nullptr), owned(true)
+{}
+
+
 void
 async_pipeline::_M_begin()
 {
     m_thread_ = std::thread([&](){
+        m_thread_id_ = std::this_thread::get_id();
         do {
-            std::unique_lock<std::mutex> lock(m_thread_mtx_);
-            m_thread_cv_.wait(lock, [&]() -> bool {
-                return
-                    m_thread_closing_  ||
-                    m_thread_has_work_ ||
-                    (m_thread_pending_ > 0);
-            });
+            if (!m_thread_has_work_ && !m_thread_notified_ &&
+                m_commands_.empty()) {
+                std::unique_lock<std::mutex> lock(m_thread_mtx_);
+                m_thread_sleeping_ = true;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_thread_cv_.wait(lock, [&]() -> bool {
+                    return
+                        m_thread_closing_  ||
+                        m_thread_has_work_ ||
+                        m_thread_notified_ ||
+                        !m_commands_.empty();
+                });
+                m_thread_sleeping_ = false;
+            }
             if (m_thread_closing_) break;
-            lock.unlock(); // release the lock
 
             _M_dowork();
         } while (true);
@@ -129,6 +129,24 @@ impact::make_udp_socket()
 }
 
 
+basic_socket
+impact::adopt_socket(
+    int               __descriptor,
+    address_family    __domain,
+    socket_type       __type,
+    internet_protocol __proto)
+{
+    if (__descriptor == INVALID_SOCKET)
+        throw impact_error("Invalid socket");
+    basic_socket result;
+    result.m_info_->descriptor = __descriptor;
+    result.m_info_->domain     = __domain;
+    result.m_info_->type       = __type;
+    result.m_info_->protocol   = __proto;
+    return result;
+}
+
+
 basic_socket::~basic_socket()
 {
     try { _M_dtor(); }
@@ -3,6 +3,7 @@
  */
 
 #include "sockets/basic_socket.h"
+#include "utils/metrics.h"
 #include "basic_socket_common.inc"
 
 using namespace impact;
@@ -102,7 +103,9 @@ basic_socket::connect(
         size
     );
 
+    if (status == SOCKET_ERROR) internal::count_error();
     ASSERT(status != SOCKET_ERROR)
+    metrics::add(metric_counter::CONNECTS);
 }
 
 
@@ -121,7 +124,9 @@ basic_socket::accept()
     ASSERT_MOVED
     basic_socket peer;
     peer.m_info_->descriptor = ::accept(m_info_->descriptor, NULL, NULL);
+    if (peer.m_info_->descriptor == INVALID_SOCKET) internal::count_error();
     ASSERT(peer.m_info_->descriptor != INVALID_SOCKET)
+    metrics::add(metric_counter::ACCEPTS);
     peer.m_info_->wsa        = false;
     peer.m_info_->domain     = m_info_->domain;
     peer.m_info_->type       = m_info_->type;
@@ -159,6 +164,11 @@ basic_socket::group(
 }
 
 
+keep_alive_options::keep_alive_options()
+: enabled(1), idletime(7200), interval(75), retries(9)
+{ /* common system defaults, but switched on */ }
+
+
 void
 basic_socket::keepalive(struct keep_alive_options __options)
 {
@@ -265,6 +275,8 @@ basic_socket::send(
         __length,
         (int)__flags
     );
+    internal::count_io(metric_counter::SEND_CALLS,
+        metric_counter::BYTES_SENT, (long)status);
     ASSERT(status != SOCKET_ERROR)
     return status;
 }
@@ -302,6 +314,8 @@ basic_socket::sendto(
         size
     );
 
+    internal::count_io(metric_counter::SEND_CALLS,
+        metric_counter::BYTES_SENT, (long)status);
     ASSERT(status != SOCKET_ERROR)
     return status;
 }
@@ -320,6 +334,8 @@ basic_socket::recv(
         __length,
         (int)__flags
     );
+    internal::count_io(metric_counter::RECV_CALLS,
+        metric_counter::BYTES_RECEIVED, (long)status);
     ASSERT(status != SOCKET_ERROR)
     return status; /* number of bytes received or EOF */
 }
@@ -346,6 +362,8 @@ basic_socket::recvfrom(
         (socklen_t*)&address_length
     );
 
+    internal::count_io(metric_counter::RECV_CALLS,
+        metric_counter::BYTES_RECEIVED, (long)status);
     ASSERT(status != SOCKET_ERROR)
 
     if (__address)
@@ -5,6 +5,22 @@
 #include "sockets/basic_socket.h"
 #include "basic_socket_common.inc"
 
+#include <climits>             // For INT_MAX
+
+#if !defined(__OS_WINDOWS__)
+    #include <fcntl.h>         // For fcntl(), O_NONBLOCK
+#endif
+
+#if defined(__OS_LINUX__)
+    #include <linux/sockios.h> // For SIOCINQ, SIOCOUTQ
+#endif
+
+#if defined(TCP_CORK)
+    #define TCP_CORK_OPTION TCP_CORK
+#elif defined(TCP_NOPUSH)
+    #define TCP_CORK_OPTION TCP_NOPUSH /* BSD equivalent */
+#endif
+
 using namespace impact;
 
 std::string
@@ -142,3 +158,379 @@ basic_socket::reuse_address(bool __enabled)
     ASSERT(status != SOCKET_ERROR)
 #endif
 }
+
+
+void
+basic_socket::busy_poll(unsigned int __microseconds)
+{
+    ASSERT_MOVED
+#if defined(SO_BUSY_POLL)
+    /* spin for up to N microseconds on the device queue
+       when blocking reads or polls find no data */
+    int duration = (int)__microseconds;
+    auto status = ::setsockopt(
+        m_info_->descriptor,
+        SOL_SOCKET,
+        SO_BUSY_POLL,
+        (CCHAR_PTR)&duration,
+        sizeof(duration)
+    );
+    ASSERT(status != SOCKET_ERROR)
+#else
+    UNUSED(__microseconds);
+    throw impact_error("Busy polling not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::prefer_busy_poll(bool __enabled)
+{
+    ASSERT_MOVED
+#if defined(SO_PREFER_BUSY_POLL)
+    int prefer = __enabled ? 1 : 0;
+    auto status = ::setsockopt(
+        m_info_->descriptor,
+        SOL_SOCKET,
+        SO_PREFER_BUSY_POLL,
+        (CCHAR_PTR)&prefer,
+        sizeof(prefer)
+    );
+    ASSERT(status != SOCKET_ERROR)
+#else
+    UNUSED(__enabled);
+    throw impact_error("Preferred busy polling not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::non_blocking(bool __enabled)
+{
+    ASSERT_MOVED
+#if defined(__OS_WINDOWS__)
+    u_long mode = __enabled ? 1 : 0;
+    auto status = ::ioctlsocket(m_info_->descriptor, FIONBIO, &mode);
+    ASSERT(status != SOCKET_ERROR)
+#else
+    auto flags = ::fcntl(m_info_->descriptor, F_GETFL, 0);
+    ASSERT(flags != SOCKET_ERROR)
+    flags = __enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    auto status = ::fcntl(m_info_->descriptor, F_SETFL, flags);
+    ASSERT(status != SOCKET_ERROR)
+#endif
+}
+
+
+void
+basic_socket::no_delay(bool __enabled)
+{
+    ASSERT_MOVED
+    _M_set_option(IPPROTO_TCP, TCP_NODELAY, __enabled ? 1 : 0);
+}
+
+
+bool
+basic_socket::no_delay()
+{
+    ASSERT_MOVED
+    return _M_get_option(IPPROTO_TCP, TCP_NODELAY) != 0;
+}
+
+
+void
+basic_socket::cork(bool __enabled)
+{
+    ASSERT_MOVED
+#if defined(TCP_CORK_OPTION)
+    /* hold partial frames until uncorked; see also message_flags::MORE */
+    _M_set_option(IPPROTO_TCP, TCP_CORK_OPTION, __enabled ? 1 : 0);
+#else
+    UNUSED(__enabled);
+    throw impact_error("Corking not supported on this platform");
+#endif
+}
+
+
+bool
+basic_socket::cork()
+{
+    ASSERT_MOVED
+#if defined(TCP_CORK_OPTION)
+    return _M_get_option(IPPROTO_TCP, TCP_CORK_OPTION) != 0;
+#else
+    throw impact_error("Corking not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::send_buffer_size(int __bytes)
+{
+    ASSERT_MOVED
+    /* pins the size; linux stops auto-tuning this buffer */
+    _M_set_option(SOL_SOCKET, SO_SNDBUF, __bytes);
+}
+
+
+int
+basic_socket::send_buffer_size()
+{
+    ASSERT_MOVED
+    /* linux reports double the requested size (bookkeeping overhead) */
+    return _M_get_option(SOL_SOCKET, SO_SNDBUF);
+}
+
+
+void
+basic_socket::receive_buffer_size(int __bytes)
+{
+    ASSERT_MOVED
+    _M_set_option(SOL_SOCKET, SO_RCVBUF, __bytes);
+}
+
+
+int
+basic_socket::receive_buffer_size()
+{
+    ASSERT_MOVED
+    return _M_get_option(SOL_SOCKET, SO_RCVBUF);
+}
+
+
+void
+basic_socket::notsent_lowat(int __bytes)
+{
+    ASSERT_MOVED
+#if defined(TCP_NOTSENT_LOWAT)
+    /* limit unsent data queued in the kernel; writability is only
+       reported once the backlog drops below this mark */
+    _M_set_option(IPPROTO_TCP, TCP_NOTSENT_LOWAT, __bytes);
+#else
+    UNUSED(__bytes);
+    throw impact_error("TCP_NOTSENT_LOWAT not supported on this platform");
+#endif
+}
+
+
+int
+basic_socket::notsent_lowat()
+{
+    ASSERT_MOVED
+#if defined(TCP_NOTSENT_LOWAT)
+    return _M_get_option(IPPROTO_TCP, TCP_NOTSENT_LOWAT);
+#else
+    throw impact_error("TCP_NOTSENT_LOWAT not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::quick_ack(bool __enabled)
+{
+    ASSERT_MOVED
+#if defined(TCP_QUICKACK)
+    /* not sticky: the kernel may fall back to delayed acks later */
+    _M_set_option(IPPROTO_TCP, TCP_QUICKACK, __enabled ? 1 : 0);
+#else
+    UNUSED(__enabled);
+    throw impact_error("Quick acknowledgements not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::priority(int __level)
+{
+    ASSERT_MOVED
+#if defined(SO_PRIORITY)
+    _M_set_option(SOL_SOCKET, SO_PRIORITY, __level);
+#else
+    UNUSED(__level);
+    throw impact_error("Socket priority not supported on this platform");
+#endif
+}
+
+
+int
+basic_socket::priority()
+{
+    ASSERT_MOVED
+#if defined(SO_PRIORITY)
+    return _M_get_option(SOL_SOCKET, SO_PRIORITY);
+#else
+    throw impact_error("Socket priority not supported on this platform");
+#endif
+}
+
+
+void
+basic_socket::latency_profile()
+{
+    ASSERT_MOVED
+    no_delay(true);
+#if defined(TCP_CORK_OPTION)
+    _M_set_option(IPPROTO_TCP, TCP_CORK_OPTION, 0);
+#endif
+#if defined(TCP_NOTSENT_LOWAT)
+    _M_set_option(IPPROTO_TCP, TCP_NOTSENT_LOWAT, 16384);
+#endif
+#if defined(TCP_QUICKACK)
+    _M_set_option(IPPROTO_TCP, TCP_QUICKACK, 1);
+#endif
+}
+
+
+void
+basic_socket::throughput_profile(int __buffer_bytes)
+{
+    ASSERT_MOVED
+    /* let Nagle coalesce small writes; fixed buffers only on request,
+       since they switch off the kernel's own buffer auto-tuning */
+    no_delay(false);
+#if defined(TCP_NOTSENT_LOWAT)
+    _M_set_option(IPPROTO_TCP, TCP_NOTSENT_LOWAT, INT_MAX);
+#endif
+    if (__buffer_bytes > 0) {
+        send_buffer_size(__buffer_bytes);
+        receive_buffer_size(__buffer_bytes);
+    }
+}
+
+
+tcp_statistics::tcp_statistics()
+: state(0), rtt(0), rtt_variance(0), rto(0), congestion_window(0),
+  slow_start_threshold(0), mss(0), unacked(0), lost(0), retransmits(0)
+{}
+
+
+struct tcp_statistics
+basic_socket::tcp_info()
+{
+    ASSERT_MOVED
+    struct tcp_statistics result;
+#if defined(__OS_LINUX__)
+    struct ::tcp_info info;
+    socklen_t length = sizeof(info);
+    ::memset(&info, 0, sizeof(info));
+    auto status = ::getsockopt(
+        m_info_->descriptor,
+        IPPROTO_TCP,
+        TCP_INFO,
+        (CHAR_PTR)&info,
+        &length
+    );
+    ASSERT(status != SOCKET_ERROR)
+    result.state                = info.tcpi_state;
+    result.rtt                  = info.tcpi_rtt;
+    result.rtt_variance         = info.tcpi_rttvar;
+    result.rto                  = info.tcpi_rto;
+    result.congestion_window    = info.tcpi_snd_cwnd;
+    result.slow_start_threshold = info.tcpi_snd_ssthresh;
+    result.mss                  = info.tcpi_snd_mss;
+    result.unacked              = info.tcpi_unacked;
+    result.lost                 = info.tcpi_lost;
+    result.retransmits          = info.tcpi_total_retrans;
+#elif defined(__OS_APPLE__) && defined(TCP_CONNECTION_INFO)
+    struct tcp_connection_info info;
+    socklen_t length = sizeof(info);
+    ::memset(&info, 0, sizeof(info));
+    auto status = ::getsockopt(
+        m_info_->descriptor,
+        IPPROTO_TCP,
+        TCP_CONNECTION_INFO,
+        (CHAR_PTR)&info,
+        &length
+    );
+    ASSERT(status != SOCKET_ERROR)
+    /* darwin reports milliseconds and a window in bytes */
+    unsigned int segment        = info.tcpi_maxseg ? info.tcpi_maxseg : 1;
+    result.state                = info.tcpi_state;
+    result.rtt                  = info.tcpi_srtt * 1000;
+    result.rtt_variance         = info.tcpi_rttvar * 1000;
+    result.rto                  = info.tcpi_rto * 1000;
+    result.congestion_window    = info.tcpi_snd_cwnd / segment;
+    result.slow_start_threshold = info.tcpi_snd_ssthresh / segment;
+    result.mss                  = info.tcpi_maxseg;
+    result.retransmits          = (unsigned int)info.tcpi_txretransmitpackets;
+#else
+    throw impact_error("TCP statistics not supported on this platform");
+#endif
+    return result;
+}
+
+
+int
+basic_socket::send_queue()
+{
+    ASSERT_MOVED
+    int value = 0;
+#if defined(SIOCOUTQ)
+    auto status = ::ioctl(m_info_->descriptor, SIOCOUTQ, &value);
+    ASSERT(status != SOCKET_ERROR)
+#elif defined(SO_NWRITE)
+    value = _M_get_option(SOL_SOCKET, SO_NWRITE);
+#else
+    throw impact_error("Send queue size not supported on this platform");
+#endif
+    return value;
+}
+
+
+int
+basic_socket::receive_queue()
+{
+    ASSERT_MOVED
+#if defined(__OS_WINDOWS__)
+    u_long value = 0;
+    auto status = ::ioctlsocket(m_info_->descriptor, FIONREAD, &value);
+#elif defined(SIOCINQ)
+    int value = 0;
+    auto status = ::ioctl(m_info_->descriptor, SIOCINQ, &value);
+#else
+    int value = 0;
+    auto status = ::ioctl(m_info_->descriptor, FIONREAD, &value);
+#endif
+    ASSERT(status != SOCKET_ERROR)
+    return (int)value;
+}
+
+
+void
+basic_socket::_M_set_option(
+    int __level,
+    int __name,
+    int __value)
+{
+    auto status = ::setsockopt(
+        m_info_->descriptor,
+        __level,
+        __name,
+        (CCHAR_PTR)&__value,
+        sizeof(__value)
+    );
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+int
+basic_socket::_M_get_option(
+    int __level,
+    int __name)
+{
+    int value = 0;
+#if defined(__OS_WINDOWS__)
+    int length = sizeof(value);
+#else
+    socklen_t length = sizeof(value);
+#endif
+    auto status = ::getsockopt(
+        m_info_->descriptor,
+        __level,
+        __name,
+        (CHAR_PTR)&value,
+        &length
+    );
+    ASSERT(status != SOCKET_ERROR)
+    return value;
+}
@@ -0,0 +1,279 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "sockets/connection_pool.h"
+
+#include <vector>
+#include <utility>
+#include <iterator>
+
+#include "utils/impact_error.h"
+#include "sockets/nonblocking.h"
+
+using namespace impact;
+
+connection_pool::options::options()
+: max_idle(8), max_total(0), idle_timeout(std::chrono::seconds(60)),
+  use_keepalive(true)
+{
+    keepalive.idletime = 30;
+    keepalive.interval = 10;
+    keepalive.retries  = 3;
+}
+
+
+connection_pool::connection_pool(struct options __options)
+: m_options_(__options), m_idle_count_(0), m_active_count_(0)
+{}
+
+
+connection_pool::~connection_pool()
+{
+    clear();
+}
+
+
+basic_socket
+connection_pool::acquire(
+    const std::string& __host,
+    unsigned short     __port)
+{
+    auto key = _S_key(__host, __port);
+
+    do {
+        basic_socket candidate;
+        {
+            std::lock_guard<std::mutex> lock(m_mtx_);
+            auto target = m_idle_.find(key);
+            if (target != m_idle_.end()) {
+                _M_evict_expired(target->second, clock::now());
+                if (!target->second.empty()) {
+                    /* newest first: the oldest ones age out */
+                    candidate = target->second.back().socket;
+                    target->second.pop_back();
+                    m_idle_count_--;
+                }
+            }
+
+            if (!candidate) {
+                if (m_options_.max_total != 0 &&
+                    m_idle_count_ + m_active_count_ >= m_options_.max_total &&
+                    !_M_evict_oldest())
+                    throw impact_error("Connection pool exhausted");
+                m_active_count_++; /* reserve the slot while connecting */
+                break;
+            }
+            m_active_count_++;
+        }
+
+        /* liveness is checked without holding the lock */
+        if (_S_alive(candidate))
+            return candidate;
+        _S_close(candidate);
+        std::lock_guard<std::mutex> lock(m_mtx_);
+        m_active_count_--;
+    } while (true);
+
+    try {
+        auto socket = make_tcp_socket();
+        socket.connect(__port, __host);
+        if (m_options_.use_keepalive) {
+            /* best effort: some platforms lack the finer knobs */
+            try { socket.keepalive(m_options_.keepalive); }
+            catch (impact_error&) { }
+        }
+        return socket;
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(m_mtx_);
+        m_active_count_--;
+        throw;
+    }
+}
+
+
+void
+connection_pool::release(
+    const std::string& __host,
+    unsigned short     __port,
+    basic_socket       __socket,
+    bool               __reusable)
+{
+    std::lock_guard<std::mutex> lock(m_mtx_);
+    if (m_active_count_ > 0)
+        m_active_count_--;
+
+    if (!__reusable || !__socket || m_options_.max_idle == 0) {
+        _S_close(__socket);
+        return;
+    }
+
+    auto& list = m_idle_[_S_key(__host, __port)];
+    while (list.size() >= m_options_.max_idle) {
+        _S_close(list.front().socket);
+        list.pop_front();
+        m_idle_count_--;
+    }
+    idle_entry entry;
+    entry.socket = __socket;
+    entry.since  = clock::now();
+    list.push_back(entry);
+    m_idle_count_++;
+}
+
+
+void
+connection_pool::evict_idle()
+{
+    /* probing is a syscall per socket: take the idle sockets out
+       under the lock, counted as active as acquire() does, check
+       and close them unlocked, then put the survivors back */
+    std::vector<std::pair<std::string,idle_entry>> candidates;
+    std::vector<basic_socket> dead;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx_);
+        auto now     = clock::now();
+        auto timeout = m_options_.idle_timeout;
+        for (auto& target : m_idle_) {
+            for (auto& entry : target.second) {
+                if (timeout.count() > 0 && entry.since + timeout <= now)
+                    dead.push_back(entry.socket);
+                else candidates.emplace_back(target.first, entry);
+            }
+        }
+        m_idle_.clear();
+        m_idle_count_    = 0;
+        m_active_count_ += candidates.size();
+    }
+
+    for (auto& socket : dead)
+        _S_close(socket);
+    dead.clear();
+    auto   taken     = candidates.size();
+    size_t survivors = 0;
+    for (size_t i = 0; i < taken; i++) {
+        if (!_S_alive(candidates[i].second.socket))
+            _S_close(candidates[i].second.socket);
+        else if (survivors++ != i)
+            candidates[survivors - 1] = std::move(candidates[i]);
+    }
+    candidates.erase(candidates.begin() + survivors, candidates.end());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx_);
+        m_active_count_ -= taken;
+        for (auto& candidate : candidates) {
+            /* release() may have queued newer sockets meanwhile */
+            auto& list     = m_idle_[candidate.first];
+            auto  position = list.end();
+            while (position != list.begin() &&
+                candidate.second.since < std::prev(position)->since)
+                position--;
+            list.insert(position, candidate.second);
+            m_idle_count_++;
+            if (list.size() > m_options_.max_idle) {
+                dead.push_back(list.front().socket);
+                list.pop_front();
+                m_idle_count_--;
+            }
+        }
+    }
+    for (auto& socket : dead)
+        _S_close(socket);
+}
+
+
+void
+connection_pool::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mtx_);
+    for (auto& target : m_idle_) {
+        for (auto& entry : target.second)
+            _S_close(entry.socket);
+    }
+    m_idle_.clear();
+    m_idle_count_ = 0;
+}
+
+
+size_t
+connection_pool::idle() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx_);
+    return m_idle_count_;
+}
+
+
+size_t
+connection_pool::active() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx_);
+    return m_active_count_;
+}
+
+
+std::string
+connection_pool::_S_key(
+    const std::string& __host,
+    unsigned short     __port)
+{
+    return __host + ":" + std::to_string(__port);
+}
+
+
+bool
+connection_pool::_S_alive(const basic_socket& __socket)
+{
+    if (!__socket) return false;
+    /* an idle request/response connection has nothing to read:
+       EOF means the peer closed it, data means the stream is out
+       of sync, and only "would block" means it is still usable */
+    char byte;
+    socket_error error;
+    auto status = internal::try_recv(__socket.get(), &byte, 1,
+        message_flags::PEEK, &error);
+    return status < 0 && error == socket_error::WOULD_BLOCK;
+}
+
+
+void
+connection_pool::_S_close(basic_socket& __socket)
+{
+    if (!__socket) return;
+    try { __socket.close(); }
+    catch (impact_error&) { }
+}
+
+
+void
+connection_pool::_M_evict_expired(
+    idle_list&        __list,
+    clock::time_point __now)
+{
+    if (m_options_.idle_timeout.count() <= 0) return;
+    while (!__list.empty() &&
+        __list.front().since + m_options_.idle_timeout <= __now) {
+        _S_close(__list.front().socket);
+        __list.pop_front();
+        m_idle_count_--;
+    }
+}
+
+
+bool
+connection_pool::_M_evict_oldest()
+{
+    auto oldest = m_idle_.end();
+    for (auto target = m_idle_.begin(); target != m_idle_.end(); target++) {
+        if (target->second.empty()) continue;
+        if (oldest == m_idle_.end() ||
+            target->second.front().since < oldest->second.front().since)
+            oldest = target;
+    }
+    if (oldest == m_idle_.end()) return false;
+    _S_close(oldest->second.front().socket);
+    oldest->second.pop_front();
+    m_idle_count_--;
+    return true;
+}
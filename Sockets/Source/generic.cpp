@@ -41,10 +41,17 @@ internal::error_code()
 
 std::string
 internal::error_message()
+{
+    return error_message(error_code());
+}
+
+
+std::string
+internal::error_message(int __code)
 {
     std::ostringstream os;
 #if defined(__OS_WINDOWS__)
-    auto error_code = WSAGetLastError();
+    auto error_code = (unsigned long)__code;
 
     std::string data;
     auto status = wsa_error_string(error_code, data);
@@ -65,8 +72,8 @@ internal::error_message()
     }
     else os << data;
 #else
-    os << strerror(errno);
-    os << " [" << errno << "]";
+    os << strerror(__code);
+    os << " [" << __code << "]";
 #endif
     return os.str();
 }
@@ -0,0 +1,146 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "sockets/nonblocking.h"
+
+#include <cerrno>
+
+#include "sockets/generic.h"
+#include "utils/metrics.h"
+
+#if defined(__OS_WINDOWS__)
+    #include <ws2tcpip.h>
+    #define CHAR_PTR  char*
+    #define CCHAR_PTR const char*
+    #define SOCKLEN   int
+#else
+    #include <sys/types.h>
+    #define CHAR_PTR  void*
+    #define CCHAR_PTR const void*
+    #define SOCKLEN   socklen_t
+    #define SOCKET_ERROR   -1
+    #define INVALID_SOCKET -1
+#endif
+
+using namespace impact;
+
+namespace impact {
+namespace internal {
+    socket_error last_error() noexcept;
+    int per_call_flags(message_flags) noexcept;
+}}
+
+
+socket_error
+internal::last_error() noexcept
+{
+    auto code = error_code();
+#if !defined(__OS_WINDOWS__)
+    /* both spellings mean the same thing to callers */
+    if (code == EAGAIN) return socket_error::WOULD_BLOCK;
+#endif
+    return (socket_error)code;
+}
+
+
+int
+internal::per_call_flags(message_flags __flags) noexcept
+{
+    auto flags = (int)__flags;
+#if defined(MSG_DONTWAIT)
+    /* don't depend on the socket's own blocking mode */
+    flags |= MSG_DONTWAIT;
+#endif
+    return flags;
+}
+
+
+int
+internal::try_recv(
+    int           __socket,
+    void*         __buffer,
+    int           __length,
+    message_flags __flags,
+    socket_error* __error) noexcept
+{
+    int status;
+    do {
+        status = (int)::recv(__socket, (CHAR_PTR)__buffer, __length,
+            per_call_flags(__flags));
+    } while (status == SOCKET_ERROR && error_code() == EINTR);
+    *__error = status == SOCKET_ERROR ? last_error() : socket_error::SUCCESS;
+    count_io(metric_counter::RECV_CALLS, metric_counter::BYTES_RECEIVED,
+        status);
+    return status;
+}
+
+
+int
+internal::try_send(
+    int           __socket,
+    const void*   __buffer,
+    int           __length,
+    message_flags __flags,
+    socket_error* __error) noexcept
+{
+    int status;
+    do {
+        status = (int)::send(__socket, (CCHAR_PTR)__buffer, __length,
+            per_call_flags(__flags));
+    } while (status == SOCKET_ERROR && error_code() == EINTR);
+    *__error = status == SOCKET_ERROR ? last_error() : socket_error::SUCCESS;
+    count_io(metric_counter::SEND_CALLS, metric_counter::BYTES_SENT,
+        status);
+    return status;
+}
+
+
+int
+internal::try_accept(
+    int           __socket,
+    socket_error* __error) noexcept
+{
+    int descriptor;
+    do {
+        descriptor = (int)::accept(__socket, NULL, NULL);
+    } while (descriptor == INVALID_SOCKET && error_code() == EINTR);
+    *__error = descriptor == INVALID_SOCKET ?
+        last_error() : socket_error::SUCCESS;
+    if (descriptor == INVALID_SOCKET) count_error();
+    else metrics::add(metric_counter::ACCEPTS);
+    return descriptor;
+}
+
+
+socket_error
+internal::try_connect(
+    int                    __socket,
+    const struct sockaddr* __address,
+    size_t                 __length) noexcept
+{
+    auto status = ::connect(__socket, __address, (SOCKLEN)__length);
+    if (status != SOCKET_ERROR)
+        return socket_error::SUCCESS;
+
+    auto error = last_error();
+    /* an interrupted connect keeps going in the background */
+    if (error == socket_error::IN_PROGRESS ||
+        error == socket_error::WOULD_BLOCK ||
+        error == socket_error::INTERRUPTED)
+        return socket_error::IN_PROGRESS;
+    return error;
+}
+
+
+socket_error
+internal::connect_result(int __socket) noexcept
+{
+    int error = 0;
+    SOCKLEN length = sizeof(error);
+    auto status = ::getsockopt(__socket, SOL_SOCKET, SO_ERROR,
+        (CHAR_PTR)&error, &length);
+    if (status == SOCKET_ERROR)
+        return last_error();
+    return (socket_error)error;
+}
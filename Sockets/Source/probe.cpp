@@ -5,19 +5,28 @@
 #include "sockets/probe.h"
 
 #include <string>
+#include <atomic>
+#include <cerrno>
+#include <climits>
 
 #include "utils/environment.h"
 #include "utils/impact_error.h"
 #include "sockets/generic.h"
 
 #if !defined(__OS_WINDOWS__)
-    #include <sys/poll.h> // For struct pollfd, poll()
+    #include <sys/poll.h>   // For struct pollfd, poll()
+    #include <sys/select.h> // pselect()
+    #include <pthread.h>    // pthread_sigmask()
 #endif
 
 #if defined(__OS_APPLE__)
     #include <unistd.h> // select()
 #endif
 
+#if defined(HAVE_EPOLL)
+    #include <unistd.h> // close()
+#endif
+
 #if defined(__OS_WINDOWS__)
     #define POLL WSAPoll
 #else
@@ -28,36 +37,75 @@
 #define ASSERT(cond)\
     if (!(cond)) throw impact_error(internal::error_message());
 
+namespace impact {
+namespace internal {
+    int to_milliseconds(std::chrono::nanoseconds);
+#if !defined(__OS_WINDOWS__)
+    struct timespec to_timespec(std::chrono::nanoseconds);
+#endif
+    int fill_fd_set(const std::vector<basic_socket*>&, fd_set*, int);
+}}
+
+
+int
+impact::internal::to_milliseconds(std::chrono::nanoseconds __timeout)
+{
+    if (__timeout.count() < 0) return -1;
+    /* round up so short waits never turn into busy loops */
+    auto milliseconds =
+        (__timeout.count() + 999999) / 1000000;
+    if (milliseconds > INT_MAX) return INT_MAX;
+    return (int)milliseconds;
+}
+
+
+#if !defined(__OS_WINDOWS__)
+struct timespec
+impact::internal::to_timespec(std::chrono::nanoseconds __timeout)
+{
+    struct timespec result;
+    result.tv_sec  = (time_t)(__timeout.count() / 1000000000);
+    result.tv_nsec = (long)(__timeout.count() % 1000000000);
+    return result;
+}
+#endif
+
+
+/* returns the larger of highest and the descriptors added */
+int
+impact::internal::fill_fd_set(
+    const std::vector<basic_socket*>& __handles,
+    fd_set*                           __set,
+    int                               __highest)
+{
+    FD_ZERO(__set);
+    for (const auto& handle : __handles) {
+        int descriptor = handle->get();
+        /* FD_SET past the end of the set writes outside of it */
+        if (descriptor < 0 || descriptor >= FD_SETSIZE)
+            throw impact_error("Descriptor exceeds FD_SETSIZE, use probe_set");
+        FD_SET(descriptor, __set);
+        if (descriptor > __highest)
+            __highest = descriptor;
+    }
+    return __highest;
+}
+
+
 int
 impact::select(
-    std::vector<basic_socket*> __read_handles,
-    std::vector<basic_socket*> __write_handles,
-    int                        __timeout,
-    unsigned int               __micro_timeout)
+    const std::vector<basic_socket*>& __read_handles,
+    const std::vector<basic_socket*>& __write_handles,
+    int                               __timeout,
+    unsigned int                      __micro_timeout)
 {
     struct timeval time_s;
     time_s.tv_sec  = (unsigned int)(0xFFFFFFFF&__timeout);
     time_s.tv_usec = __micro_timeout;
 
     fd_set read_set, write_set;
-    unsigned int num_fds = 0;
-
-    FD_ZERO(&read_set);
-    FD_ZERO(&write_set);
-
-    for (const auto& handle : __read_handles) {
-        unsigned int descriptor = handle->get();
-        FD_SET(descriptor, &read_set);
-        if (descriptor > num_fds)
-            num_fds = descriptor;
-    }
-
-    for (const auto& handle : __write_handles) {
-        unsigned int descriptor = handle->get();
-        FD_SET(descriptor, &write_set);
-        if (descriptor > num_fds)
-            num_fds = descriptor;
-    }
+    int num_fds = internal::fill_fd_set(__read_handles, &read_set, 0);
+    num_fds = internal::fill_fd_set(__write_handles, &write_set, num_fds);
 
     auto status = ::select(
         num_fds + 1,
@@ -71,6 +119,35 @@ impact::select(
 }
 
 
+int
+impact::select(
+    const std::vector<basic_socket*>& __read_handles,
+    const std::vector<basic_socket*>& __write_handles,
+    std::chrono::nanoseconds          __timeout)
+{
+#if defined(__OS_WINDOWS__)
+    auto microseconds = (__timeout.count() + 999) / 1000;
+    return impact::select(__read_handles, __write_handles,
+        __timeout.count() < 0 ? -1 : (int)(microseconds / 1000000),
+        (unsigned int)(microseconds % 1000000));
+#else
+    fd_set read_set, write_set;
+    int num_fds = internal::fill_fd_set(__read_handles, &read_set, 0);
+    num_fds = internal::fill_fd_set(__write_handles, &write_set, num_fds);
+
+    auto time_s = internal::to_timespec(__timeout);
+    return ::pselect(
+        num_fds + 1,
+        &read_set,
+        &write_set,
+        NULL,
+        ((__timeout.count() < 0) ? NULL : &time_s),
+        NULL
+    );
+#endif
+}
+
+
 impact::poll_handle::poll_handle()
 : socket(-1), events(0), return_events(0)
 {}
@@ -85,7 +162,7 @@ impact::poll(
         return 0;
 
     /* timeout: -1 blocking, 0 nonblocking, 0> timeout */
-    struct poll_handle* handles     = &(*__handles)[0];
+    struct poll_handle* handles     = __handles->data();
     struct pollfd* poll_descriptors = reinterpret_cast<struct pollfd*>(handles);
     auto size                       = __handles->size();
     auto status                     = POLL(poll_descriptors, size, __timeout);
@@ -93,3 +170,302 @@ impact::poll(
     /* status: -1 error, 0 timeout, 0 > success */
     return status;
 }
+
+
+int
+impact::poll(
+    std::vector<impact::poll_handle>* __handles,
+    std::chrono::nanoseconds          __timeout)
+{
+#if defined(__OS_WINDOWS__)
+    return impact::poll(__handles, internal::to_milliseconds(__timeout));
+#else
+    return impact::poll(__handles, __timeout, NULL);
+#endif
+}
+
+
+#if !defined(__OS_WINDOWS__)
+int
+impact::poll(
+    std::vector<impact::poll_handle>* __handles,
+    std::chrono::nanoseconds          __timeout,
+    const sigset_t*                   __sigmask)
+{
+    if (!__handles)
+        return 0;
+
+    struct pollfd* poll_descriptors =
+        reinterpret_cast<struct pollfd*>(__handles->data());
+#if defined(__OS_LINUX__)
+    auto time_s = internal::to_timespec(__timeout);
+    return ::ppoll(
+        poll_descriptors,
+        __handles->size(),
+        ((__timeout.count() < 0) ? NULL : &time_s),
+        __sigmask
+    );
+#else
+    /* not atomic: a signal may slip in before poll() is entered */
+    sigset_t original;
+    if (__sigmask)
+        ::pthread_sigmask(SIG_SETMASK, __sigmask, &original);
+    auto status = POLL(poll_descriptors, __handles->size(),
+        internal::to_milliseconds(__timeout));
+    if (__sigmask) {
+        auto error = errno;
+        ::pthread_sigmask(SIG_SETMASK, &original, NULL);
+        errno = error;
+    }
+    return status;
+#endif
+}
+#endif
+
+
+/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - *\
+|  Probe Set Function Implementations                                         |
+\* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+
+impact::probe_set::probe_set()
+{
+#if defined(HAVE_EPOLL)
+    m_descriptor_ = ::epoll_create1(EPOLL_CLOEXEC);
+    ASSERT(m_descriptor_ != -1)
+#endif
+}
+
+
+impact::probe_set::~probe_set()
+{
+#if defined(HAVE_EPOLL)
+    if (m_descriptor_ != -1)
+        ::close(m_descriptor_);
+#endif
+}
+
+
+void
+impact::probe_set::add(
+    int   __socket,
+    short __events,
+    void* __data)
+{
+    if (__socket < 0)
+        throw impact_error("Invalid socket");
+    if (m_entries_.find(__socket) != m_entries_.end())
+        throw impact_error("Socket already in probe set");
+
+    auto& target  = m_entries_[__socket];
+    target.socket = __socket;
+    target.events = __events;
+    target.data   = __data;
+
+#if defined(HAVE_EPOLL)
+    /* poll and epoll share the same event bit values on linux */
+    struct epoll_event event;
+    event.events   = (unsigned short)__events;
+    event.data.ptr = &target;
+    auto status = ::epoll_ctl(m_descriptor_, EPOLL_CTL_ADD, __socket, &event);
+    if (status == -1) {
+        auto message = internal::error_message();
+        m_entries_.erase(__socket);
+        throw impact_error(message);
+    }
+    target.index = 0;
+#else
+    struct poll_handle handle;
+    handle.socket = __socket;
+    handle.events = __events;
+    target.index  = m_handles_.size();
+    m_handles_.push_back(handle);
+#endif
+}
+
+
+void
+impact::probe_set::modify(
+    int   __socket,
+    short __events,
+    void* __data)
+{
+    auto target = m_entries_.find(__socket);
+    if (target == m_entries_.end())
+        throw impact_error("Socket not in probe set");
+
+#if defined(HAVE_EPOLL)
+    struct epoll_event event;
+    event.events   = (unsigned short)__events;
+    event.data.ptr = &target->second;
+    auto status = ::epoll_ctl(m_descriptor_, EPOLL_CTL_MOD, __socket, &event);
+    ASSERT(status != -1)
+#else
+    m_handles_[target->second.index].events = __events;
+#endif
+    target->second.events = __events;
+    target->second.data   = __data;
+}
+
+
+void
+impact::probe_set::remove(int __socket)
+{
+    auto target = m_entries_.find(__socket);
+    if (target == m_entries_.end())
+        throw impact_error("Socket not in probe set");
+
+#if defined(HAVE_EPOLL)
+    struct epoll_event event; /* non-null for kernels before 2.6.9 */
+    auto status = ::epoll_ctl(m_descriptor_, EPOLL_CTL_DEL, __socket, &event);
+    /* closed descriptors are removed from the epoll set automatically */
+    if (status == -1 && errno != EBADF && errno != ENOENT) {
+        m_entries_.erase(target);
+        throw impact_error(internal::error_message());
+    }
+#else
+    /* swap with the last handle to keep removal O(1) */
+    auto index = target->second.index;
+    if (index != m_handles_.size() - 1) {
+        m_handles_[index] = m_handles_.back();
+        m_entries_[m_handles_[index].socket].index = index;
+    }
+    m_handles_.pop_back();
+#endif
+    m_entries_.erase(target);
+}
+
+
+bool
+impact::probe_set::contains(int __socket) const noexcept
+{
+    return m_entries_.find(__socket) != m_entries_.end();
+}
+
+
+size_t
+impact::probe_set::size() const noexcept
+{
+    return m_entries_.size();
+}
+
+
+int
+impact::probe_set::wait(
+    std::vector<probe_event>* __ready,
+    int                       __timeout)
+{
+    if (__ready) __ready->clear();
+
+#if defined(HAVE_EPOLL)
+    m_events_.resize(m_entries_.size() == 0 ? 1 : m_entries_.size());
+    auto status = ::epoll_wait(
+        m_descriptor_,
+        &m_events_[0],
+        (int)m_events_.size(),
+        __timeout
+    );
+#else
+    auto status = impact::poll(&m_handles_, __timeout);
+#endif
+
+    return _M_collect(status, __ready);
+}
+
+
+int
+impact::probe_set::wait(
+    std::vector<probe_event>* __ready,
+    std::chrono::nanoseconds  __timeout)
+{
+#if defined(__OS_WINDOWS__)
+    return wait(__ready, internal::to_milliseconds(__timeout));
+#else
+    return wait(__ready, __timeout, NULL);
+#endif
+}
+
+
+#if !defined(__OS_WINDOWS__)
+int
+impact::probe_set::wait(
+    std::vector<probe_event>* __ready,
+    std::chrono::nanoseconds  __timeout,
+    const sigset_t*           __sigmask)
+{
+    if (__ready) __ready->clear();
+
+#if defined(HAVE_EPOLL)
+    m_events_.resize(m_entries_.size() == 0 ? 1 : m_entries_.size());
+    int status = -1;
+    errno = ENOSYS;
+#if defined(HAVE_EPOLL_PWAIT2)
+    /* kernels before 5.11 report ENOSYS; remember and stop trying */
+    static std::atomic<bool> s_has_pwait2(true);
+    if (s_has_pwait2) {
+        auto time_s = internal::to_timespec(__timeout);
+        status = ::epoll_pwait2(
+            m_descriptor_,
+            &m_events_[0],
+            (int)m_events_.size(),
+            ((__timeout.count() < 0) ? NULL : &time_s),
+            __sigmask
+        );
+        if (status == -1 && errno == ENOSYS)
+            s_has_pwait2 = false;
+    }
+#endif
+    if (status == -1 && errno == ENOSYS) {
+        status = ::epoll_pwait(
+            m_descriptor_,
+            &m_events_[0],
+            (int)m_events_.size(),
+            internal::to_milliseconds(__timeout),
+            __sigmask
+        );
+    }
+#else
+    auto status = impact::poll(&m_handles_, __timeout, __sigmask);
+#endif
+
+    return _M_collect(status, __ready);
+}
+#endif
+
+
+int
+impact::probe_set::_M_collect(
+    int                       __status,
+    std::vector<probe_event>* __ready)
+{
+    if (__status <= 0)
+        return __status;
+
+#if defined(HAVE_EPOLL)
+    if (!__ready)
+        return __status;
+
+    for (int i = 0; i < __status; i++) {
+        const auto* target = (const entry*)m_events_[i].data.ptr;
+        struct probe_event event;
+        event.socket        = target->socket;
+        event.return_events = (short)m_events_[i].events;
+        event.data          = target->data;
+        __ready->push_back(event);
+    }
+#else
+    for (auto& handle : m_handles_) {
+        if (handle.return_events == 0) continue;
+        if (__ready) {
+            struct probe_event event;
+            event.socket        = handle.socket;
+            event.return_events = handle.return_events;
+            event.data          = m_entries_[handle.socket].data;
+            __ready->push_back(event);
+        }
+        handle.return_events = 0;
+    }
+#endif
+
+    return __status;
+}
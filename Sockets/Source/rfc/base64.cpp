@@ -4,197 +4,826 @@
 
 #include "rfc/base64.h"
 
-#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
 
 #include "utils/impact_error.h"
 #include "utils/errno.h"
+#include "utils/cpu_features.h"
 
 using namespace impact;
 
+namespace impact {
+namespace internal {
+    /* Built once per alphabet on first use. pairs[] holds both
+       symbols for every 12-bit value; decode[n][c] holds symbol c
+       already shifted into position n of a 24-bit group, or
+       k_bad_symbol when c is not in the alphabet, so one OR per group
+       collects every error. */
+    struct base64_tables {
+        static const std::uint32_t k_bad_symbol = 0x01000000;
+        char          pairs[4096][2];
+        std::uint32_t decode[4][256];
+        explicit base64_tables(const char* symbols);
+    };
+
+    const base64_tables& b64_tables(bool url_safe);
+    /* characters per line, or 0 for a single line */
+    size_t b64_line(const base64::options& variant) noexcept;
+
+    /* block kernels (rfc/base64_simd.cpp); each returns how much of
+       the input it converted, the scalar loops finish the rest */
+    typedef size_t (*b64_encoder)(const unsigned char*, size_t, char*,
+        bool);
+    typedef size_t (*b64_decoder)(const unsigned char*, size_t,
+        unsigned char*, bool);
+    b64_encoder b64_encode_kernel(simd_level level) noexcept;
+    b64_decoder b64_decode_kernel(simd_level level) noexcept;
+
+#if defined(HAVE_X86_SIMD)
+    size_t b64_encode_ssse3(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_encode_avx2(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_encode_avx512(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_decode_ssse3(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+    size_t b64_decode_avx2(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+    size_t b64_decode_avx512(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+#endif
+}}
+
+
 const std::string base64::k_alphabet =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-const char          base64::k_pad         = '=';
-const unsigned char base64::k_symbol_size = 6;
-const unsigned char base64::k_symbol      = 0x3F;
-const unsigned char base64::k_byte        = 0xFF;
+const char base64::k_pad = '=';
+
+
+internal::base64_tables::base64_tables(const char* __symbols)
+{
+    for (unsigned int i = 0; i < 4096; i++) {
+        pairs[i][0] = __symbols[i >> 6];
+        pairs[i][1] = __symbols[i & 0x3F];
+    }
+    for (unsigned int c = 0; c < 256; c++) {
+        for (unsigned int n = 0; n < 4; n++)
+            decode[n][c] = k_bad_symbol;
+    }
+    for (unsigned int v = 0; v < 64; v++) {
+        auto c = (unsigned char)__symbols[v];
+        decode[0][c] = v << 18;
+        decode[1][c] = v << 12;
+        decode[2][c] = v << 6;
+        decode[3][c] = v;
+    }
+}
+
+
+const internal::base64_tables&
+internal::b64_tables(bool __url_safe)
+{
+    static const base64_tables standard(
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+    static const base64_tables url(
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+    return __url_safe ? url : standard;
+}
+
+
+size_t
+internal::b64_line(const base64::options& __variant) noexcept
+{
+    if (__variant.line_length == 0) return 0;
+    return std::max<size_t>(4, __variant.line_length / 4 * 4);
+}
+
+
+internal::b64_encoder
+internal::b64_encode_kernel(simd_level __level) noexcept
+{
+    switch (__level) {
+#if defined(HAVE_X86_SIMD)
+    case simd_level::SSSE3:  return b64_encode_ssse3;
+    case simd_level::AVX2:   return b64_encode_avx2;
+    case simd_level::AVX512: return b64_encode_avx512;
+#endif
+    default: return NULL;
+    }
+}
+
+
+internal::b64_decoder
+internal::b64_decode_kernel(simd_level __level) noexcept
+{
+    switch (__level) {
+#if defined(HAVE_X86_SIMD)
+    case simd_level::SSSE3:  return b64_decode_ssse3;
+    case simd_level::AVX2:   return b64_decode_avx2;
+    case simd_level::AVX512: return b64_decode_avx512;
+#endif
+    default: return NULL;
+    }
+}
+
+
+base64::options::options() noexcept
+: url_safe(false), padding(true), line_length(0)
+{}
+
+
+base64::options
+base64::options::url() noexcept
+{
+    options variant;
+    variant.url_safe = true;
+    variant.padding  = false;
+    return variant;
+}
+
+
+base64::options
+base64::options::mime() noexcept
+{
+    options variant;
+    variant.line_length = 76;
+    return variant;
+}
 
 
 base64::base64()
 {}
 
 
+size_t
+base64::encoded_size(
+    size_t         __length,
+    const options& __variant) noexcept
+{
+    size_t size = (__length + 2) / 3 * 4;
+    if (!__variant.padding && __length % 3)
+        size -= 3 - __length % 3;
+
+    auto line = internal::b64_line(__variant);
+    if (line && size)
+        size += (size - 1) / line * 2;
+    return size;
+}
+
+
+size_t
+base64::decoded_size(size_t __length) noexcept
+{
+    return (__length + 3) / 4 * 3;
+}
+
+
 bool
 base64::encode(
     const std::string& __data,
-    std::string*       __result)
+    std::string*       __result,
+    const options&     __variant)
 {
     imp_errno = imperr::SUCCESS;
-    if (__data.length() == 0)
-        return "";
+    if (__result) {
+        /* one allocation, sized exactly */
+        __result->resize(encoded_size(__data.size(), __variant));
+        if (!__data.empty())
+            encode(__data.data(), __data.size(), &(*__result)[0], __variant);
+    }
+    return true;
+}
 
-    std::ostringstream os;
 
-    _S_run_encode(__data, &os);
-    _S_pad_stream(__data, &os);
-    
-    if (__result)
-        *__result = os.str();
-    return true;
+size_t
+base64::encode(
+    const void*    __data,
+    size_t         __length,
+    char*          __result,
+    const options& __variant) noexcept
+{
+    if (__variant.line_length == 0) {
+        return _S_encode((const unsigned char*)__data, __length, __result,
+            (int)internal::simd(), __variant);
+    }
+    encoder lines(__variant);
+    auto count = lines.update(__data, __length, __result);
+    return count + lines.finish(__result + count);
 }
 
 
-void
-base64::_S_run_encode(
-    const std::string&  __data,
-    std::ostringstream* __stream)
-{
-    unsigned int   reg24;
-    unsigned short reg16[4];
-    
-    for (size_t i = 0; (i + 2) < __data.length(); i += 3) {
-        reg24 = ((0xFF & __data[i    ]) << 16) |
-                ((0xFF & __data[i + 1]) <<  8) |
-                ((0xFF & __data[i + 2]));
-        for (int j = 3; j >= 0; j--) {
-            reg16[j] = reg24 & k_symbol;
-            reg24 >>= k_symbol_size;
+size_t
+base64::_S_encode(
+    const unsigned char* __data,
+    size_t               __length,
+    char*                __result,
+    int                  __level,
+    const options&       __variant) noexcept
+{
+    const auto& tables = internal::b64_tables(__variant.url_safe);
+    auto input  = __data;
+    auto output = __result;
+
+    size_t i = 0;
+    auto kernel =
+        internal::b64_encode_kernel((internal::simd_level)__level);
+    if (kernel) {
+        i = kernel(input, __length, output, __variant.url_safe);
+        output += i / 3 * 4;
+    }
+    for (; i + 3 <= __length; i += 3) {
+        std::uint32_t group =
+            ((std::uint32_t)input[i] << 16) |
+            ((std::uint32_t)input[i + 1] << 8) |
+            input[i + 2];
+        std::memcpy(output,     tables.pairs[group >> 12],   2);
+        std::memcpy(output + 2, tables.pairs[group & 0xFFF], 2);
+        output += 4;
+    }
+
+    auto remaining = __length - i;
+    if (remaining) {
+        std::uint32_t group = (std::uint32_t)input[i] << 16;
+        if (remaining == 2) group |= (std::uint32_t)input[i + 1] << 8;
+        std::memcpy(output, tables.pairs[group >> 12], 2);
+        output += 2;
+        if (remaining == 2)
+            *output++ = tables.pairs[group & 0xFFF][0];
+        if (__variant.padding) {
+            if (remaining == 1) *output++ = k_pad;
+            *output++ = k_pad;
         }
-        for (int j = 0; j < 4; j++)
-            *__stream << k_alphabet[reg16[j]];
     }
+    return (size_t)(output - __result);
 }
 
 
-void
-base64::_S_pad_stream(
-    const std::string&  __data,
-    std::ostringstream* __stream)
-{
-    unsigned int reg24;
-    unsigned short reg16[4];
-    unsigned char pad_count =
-        (__data.length() % 3 + (__data.length() + 1) % 3) - 1;
-    
-    if (pad_count != 0)  {
-        std::string padding(pad_count, k_pad);
-        reg24 = ((0xFF & __data[__data.length() - 3 + pad_count]) << 16);
-        if (pad_count == 1)
-            reg24 |= ((0xFF & __data[__data.length() - 1]) <<  8);
-        else reg24 >>= k_symbol_size;
-        for (short i = (3 - pad_count); i >= 0; i--) {
-            reg24 >>= k_symbol_size;
-            reg16[i] = reg24 & k_symbol;
+bool
+base64::decode(
+    const std::string& __data,
+    std::string*       __result,
+    const options&     __variant)
+{
+    imp_errno = imperr::SUCCESS;
+    if (!__result) {
+        /* validation only: decode through a fixed-size buffer */
+        decoder state(__variant);
+        unsigned char output[3 * 1024];
+        size_t count;
+        for (size_t i = 0; i < __data.size(); i += 4 * 1024) {
+            auto length = std::min<size_t>(4 * 1024, __data.size() - i);
+            if (!state.update(__data.data() + i, length, output, &count))
+                return false;
         }
-        for (short i = 0; i <= (3 - pad_count); i++)
-            *__stream << k_alphabet[reg16[i]];
-        *__stream << padding;
+        return state.finish(output, &count);
+    }
+
+    /* result is only written on success */
+    std::string decoded;
+    if (!__data.empty()) {
+        decoded.resize(decoded_size(__data.size()));
+        size_t written = 0;
+        if (!decode(__data.data(), __data.size(), &decoded[0], &written,
+                __variant))
+            return false;
+        decoded.resize(written);
     }
+    __result->swap(decoded);
+    return true;
 }
 
 
 bool
 base64::decode(
-    const std::string& __data,
-    std::string*       __result)
+    const char*    __data,
+    size_t         __length,
+    void*          __result,
+    size_t*        __written,
+    const options& __variant) noexcept
+{
+    if (__variant.line_length == 0) {
+        return _S_decode(__data, __length, (unsigned char*)__result,
+            __written, (int)internal::simd(), __variant);
+    }
+
+    decoder lines(__variant);
+    size_t tail;
+    if (!lines.update(__data, __length, __result, __written))
+        return false;
+    if (!lines.finish((unsigned char*)__result + *__written, &tail))
+        return false;
+    *__written += tail;
+    return true;
+}
+
+
+bool
+base64::_S_decode(
+    const char*          __data,
+    size_t               __length,
+    unsigned char*       __result,
+    size_t*              __written,
+    int                  __level,
+    const options&       __variant) noexcept
 {
     imp_errno = imperr::SUCCESS;
-    if (__data.length() == 0)
-        return "";
-
-    std::ostringstream stream;
-    unsigned short     padding = 0;
-    unsigned short     tally   = 0;
-    unsigned int       reg24   = 0;
-    
-    // impact_errno: see run_decode()
-    if (!_S_run_decode(
-        __data,
-        &stream,
-        &padding,
-        &tally,
-        &reg24
-    )) return false;
-    
-    // impact_errno: see unpad_stream
-    if (!_S_unpad_stream(
-        &stream,
-        &padding,
-        &tally,
-        &reg24
-    )) return false;
-
-    if (__result)
-        *__result = stream.str();
-    
+    auto output = __result;
+    *__written  = 0;
+    if (__length == 0) return true;
+
+    /* anything but whole groups with at most two trailing pads, or an
+       unpadded tail where that is allowed, takes the symbol-by-symbol
+       path, which tolerates stray padding */
+    size_t padding = 0;
+    if (__data[__length - 1] == k_pad) padding++;
+    if (__length > 1 && __data[__length - 2] == k_pad) padding++;
+
+    size_t groups, tail;
+    if (__length % 4 == 0 &&
+        !(padding == 1 && __data[__length - 2] == k_pad)) {
+        groups = __length / 4 - (padding ? 1 : 0);
+        tail   = padding ? 4 - padding : 0;
+    }
+    else if (__length % 4 >= 2 && padding == 0 && !__variant.padding) {
+        groups = __length / 4;
+        tail   = __length % 4;
+    }
+    else return _S_decode_lenient(__data, __length, output, __written,
+        __variant);
+
+    const auto& decode = internal::b64_tables(__variant.url_safe).decode;
+    auto input = (const unsigned char*)__data;
+    std::uint32_t errors = 0;
+
+    size_t g = 0;
+    auto kernel =
+        internal::b64_decode_kernel((internal::simd_level)__level);
+    if (kernel) {
+        g = kernel(input, groups * 4, output, __variant.url_safe) / 4;
+        input  += g * 4;
+        output += g * 3;
+    }
+    for (; g < groups; g++, input += 4, output += 3) {
+        auto group =
+            decode[0][input[0]] | decode[1][input[1]] |
+            decode[2][input[2]] | decode[3][input[3]];
+        errors   |= group;
+        output[0] = (unsigned char)(group >> 16);
+        output[1] = (unsigned char)(group >> 8);
+        output[2] = (unsigned char)group;
+    }
+
+    if (tail) {
+        auto group =
+            decode[0][input[0]] | decode[1][input[1]] |
+            (tail == 3 ? decode[2][input[2]] : 0);
+        errors   |= group;
+        *output++ = (unsigned char)(group >> 16);
+        if (tail == 3)
+            *output++ = (unsigned char)(group >> 8);
+    }
+
+    if (errors & internal::base64_tables::k_bad_symbol) {
+        /* pads inside the data are skipped rather than rejected */
+        if (std::memchr(__data, k_pad, __length - padding))
+            return _S_decode_lenient(__data, __length, __result, __written,
+                __variant);
+        imp_errno = imperr::B64_BADSYM;
+        return false;
+    }
+    *__written = (size_t)(output - __result);
     return true;
 }
 
 
 bool
-base64::_S_run_decode(
-    const std::string&  __data,
-    std::ostringstream* __stream,
-    unsigned short*     __padding,
-    unsigned short*     __tally,
-    unsigned int*       __reg24)
-{
-    for (unsigned int i = 0; i < __data.length(); i++) {
-        if (__data[i] == '=') {
-            if ((__data.length() - i) <= 2)
-                (*__padding)++;
+base64::_S_decode_lenient(
+    const char*    __data,
+    size_t         __length,
+    unsigned char* __result,
+    size_t*        __written,
+    const options& __variant) noexcept
+{
+    const auto& symbols =
+        internal::b64_tables(__variant.url_safe).decode[3];
+    auto output          = __result;
+    unsigned int padding = 0;
+    unsigned int tally   = 0;
+    std::uint32_t group  = 0;
+
+    for (size_t i = 0; i < __length; i++) {
+        if (__data[i] == k_pad) {
+            if ((__length - i) <= 2) padding++;
             continue;
         }
-        auto c = _S_reverse_lookup(__data[i]);
-        if (c == '\x40') {
+        auto value = symbols[(unsigned char)__data[i]];
+        if (value & internal::base64_tables::k_bad_symbol) {
             imp_errno = imperr::B64_BADSYM;
             return false;
         }
-        else {
-            (*__reg24) |= c;
-            (*__tally)++;
-            if ((*__tally) == 4) {
-                (*__stream) << (unsigned char)((*__reg24) >> 16);
-                (*__stream) << (unsigned char)(((*__reg24) >> 8) & k_byte);
-                (*__stream) << (unsigned char)((*__reg24) & k_byte);
-                (*__tally) = (unsigned short)0;
-                (*__reg24) = 0;
-            }
-            else (*__reg24) <<= k_symbol_size;
+        group = (group << 6) | value;
+        if (++tally == 4) {
+            *output++ = (unsigned char)(group >> 16);
+            *output++ = (unsigned char)(group >> 8);
+            *output++ = (unsigned char)group;
+            tally = 0;
+            group = 0;
         }
     }
+
+    if (!_S_decode_tail(group, tally, padding, __variant, &output))
+        return false;
+    *__written = (size_t)(output - __result);
     return true;
 }
 
 
 bool
-base64::_S_unpad_stream(
-    std::ostringstream* __stream,
-    unsigned short*     __padding,
-    unsigned short*     __tally,
-    unsigned int*       __reg24)
-{
-    if ((*__padding + *__tally) == 4) {
-        *__reg24 <<= (k_symbol_size * (*__padding - 1));
-        *__stream << (unsigned char)(*__reg24 >> 16);
-        if (*__padding != 2)
-            *__stream << (unsigned char)((*__reg24 >> 8) & k_byte);
-    }
-    else if ((*__padding + *__tally) != 0) {
+base64::_S_decode_tail(
+    std::uint32_t   __group,
+    unsigned int    __tally,
+    unsigned int    __padding,
+    const options&  __variant,
+    unsigned char** __output) noexcept
+{
+    if (__tally == 0 && __padding == 0)
+        return true;
+
+    bool padded   = __padding + __tally == 4;
+    bool unpadded = __padding == 0 && __tally >= 2 && !__variant.padding;
+    if (!padded && !unpadded) {
         imp_errno = imperr::B64_BADPAD;
         return false;
     }
+
+    auto& output = *__output;
+    __group <<= 6 * (4 - __tally);
+    *output++ = (unsigned char)(__group >> 16);
+    if (__tally == 3)
+        *output++ = (unsigned char)(__group >> 8);
+    return true;
+}
+
+
+bool
+base64::encode(
+    std::istream&  __data,
+    std::ostream&  __result,
+    const options& __variant)
+{
+    imp_errno = imperr::SUCCESS;
+    encoder state(__variant);
+    char input[3 * 1024];
+    /* room for the line breaks of the narrowest lines */
+    char output[4 * 1024 + 2 * 1024 + 8];
+
+    do {
+        __data.read(input, sizeof(input));
+        auto count = state.update(input, (size_t)__data.gcount(), output);
+        if (!__result.write(output, (std::streamsize)count))
+            return false;
+    } while (__data);
+    if (__data.bad())
+        return false;
+
+    auto count = state.finish(output);
+    return (bool)__result.write(output, (std::streamsize)count);
+}
+
+
+bool
+base64::decode(
+    std::istream&  __data,
+    std::ostream&  __result,
+    const options& __variant)
+{
+    imp_errno = imperr::SUCCESS;
+    decoder state(__variant);
+    char input[4 * 1024];
+    char output[3 * 1024];
+    size_t count;
+
+    do {
+        __data.read(input, sizeof(input));
+        if (!state.update(input, (size_t)__data.gcount(), output, &count))
+            return false;
+        if (!__result.write(output, (std::streamsize)count))
+            return false;
+    } while (__data);
+    if (__data.bad())
+        return false;
+
+    if (!state.finish(output, &count))
+        return false;
+    return (bool)__result.write(output, (std::streamsize)count);
+}
+
+
+base64::encoder::encoder(const options& __variant) noexcept
+: m_options_(__variant), m_line_(internal::b64_line(__variant)),
+  m_column_(0), m_carried_(0)
+{}
+
+
+size_t
+base64::encoder::max_output(size_t __length) const noexcept
+{
+    /* the two carried bytes fit in the rounding of encoded_size() */
+    auto size = base64::encoded_size(__length);
+    if (m_line_)
+        size += (size / m_line_ + 1) * 2;
+    return size;
+}
+
+
+size_t
+base64::encoder::update(
+    const void* __data,
+    size_t      __length,
+    char*       __result) noexcept
+{
+    auto input  = (const unsigned char*)__data;
+    auto output = __result;
+
+    if (m_carried_) {
+        if (m_carried_ + __length < 3) {
+            std::memcpy(m_carry_ + m_carried_, input, __length);
+            m_carried_ += (unsigned int)__length;
+            return 0;
+        }
+        unsigned char group[3];
+        auto needed = 3 - m_carried_;
+        std::memcpy(group, m_carry_, m_carried_);
+        std::memcpy(group + m_carried_, input, needed);
+        output    = _M_encode(group, 3, output);
+        input    += needed;
+        __length -= needed;
+    }
+
+    auto whole = __length / 3 * 3;
+    output     = _M_encode(input, whole, output);
+    m_carried_ = (unsigned int)(__length - whole);
+    std::memcpy(m_carry_, input + whole, m_carried_);
+    return (size_t)(output - __result);
+}
+
+
+size_t
+base64::encoder::finish(char* __result) noexcept
+{
+    auto output = __result;
+    if (m_carried_) {
+        if (m_line_ && m_column_ == m_line_) {
+            *output++ = '\r';
+            *output++ = '\n';
+        }
+        output += _S_encode(m_carry_, m_carried_, output,
+            (int)internal::simd(), m_options_);
+    }
+    reset();
+    return (size_t)(output - __result);
+}
+
+
+void
+base64::encoder::update(
+    const std::string& __data,
+    std::string*       __result)
+{
+    auto offset = __result->size();
+    __result->resize(offset + max_output(__data.size()));
+    auto count = update(__data.data(), __data.size(), &(*__result)[offset]);
+    __result->resize(offset + count);
+}
+
+
+void
+base64::encoder::finish(std::string* __result)
+{
+    char tail[6];
+    __result->append(tail, finish(tail));
+}
+
+
+void
+base64::encoder::reset() noexcept
+{
+    m_column_  = 0;
+    m_carried_ = 0;
+}
+
+
+char*
+base64::encoder::_M_encode(
+    const unsigned char* __data,
+    size_t               __length,
+    char*                __output) noexcept
+{
+    /* whole groups only; a line break goes out just before the first
+       symbol of the next line, so the text never ends with one */
+    while (__length) {
+        auto count = __length;
+        if (m_line_) {
+            if (m_column_ == m_line_) {
+                *__output++ = '\r';
+                *__output++ = '\n';
+                m_column_   = 0;
+            }
+            count = std::min(count, (m_line_ - m_column_) / 4 * 3);
+        }
+        auto written = _S_encode(__data, count, __output,
+            (int)internal::simd(), m_options_);
+        __output  += written;
+        m_column_ += written;
+        __data    += count;
+        __length  -= count;
+    }
+    return __output;
+}
+
+
+base64::decoder::decoder(const options& __variant) noexcept
+: m_options_(__variant), m_group_(0), m_tally_(0), m_padding_(0),
+  m_failed_(false)
+{}
+
+
+size_t
+base64::decoder::max_output(size_t __length) noexcept
+{
+    /* the three carried symbols fit in the rounding of decoded_size() */
+    return decoded_size(__length);
+}
+
+
+bool
+base64::decoder::update(
+    const char* __data,
+    size_t      __length,
+    void*       __result,
+    size_t*     __written) noexcept
+{
+    imp_errno  = imperr::SUCCESS;
+    *__written = 0;
+    if (m_failed_) {
+        imp_errno = imperr::B64_BADSYM;
+        return false;
+    }
+
+    auto output = (unsigned char*)__result;
+    if (m_options_.line_length == 0) {
+        if (!_M_segment(__data, __length, &output))
+            return false;
+    }
+    else {
+        /* one line at a time, without its CRLF */
+        size_t i = 0;
+        while (i < __length) {
+            auto newline = (const char*)std::memchr(__data + i, '\n',
+                __length - i);
+            size_t end  = newline ? (size_t)(newline - __data) : __length;
+            size_t stop = end;
+            if (stop > i && __data[stop - 1] == '\r') stop--;
+            if (!_M_segment(__data + i, stop - i, &output))
+                return false;
+            i = newline ? end + 1 : __length;
+        }
+    }
+
+    /* a block that fell back to _M_push() may have set it */
+    imp_errno  = imperr::SUCCESS;
+    *__written = (size_t)(output - (unsigned char*)__result);
+    return true;
+}
+
+
+bool
+base64::decoder::finish(
+    void*   __result,
+    size_t* __written) noexcept
+{
+    imp_errno  = imperr::SUCCESS;
+    *__written = 0;
+    auto output = (unsigned char*)__result;
+    bool success = true;
+
+    if (m_failed_) {
+        imp_errno = imperr::B64_BADSYM;
+        success   = false;
+    }
+    else success = _S_decode_tail(m_group_, m_tally_, m_padding_,
+        m_options_, &output);
+
+    *__written = (size_t)(output - (unsigned char*)__result);
+    reset();
+    return success;
+}
+
+
+bool
+base64::decoder::update(
+    const std::string& __data,
+    std::string*       __result)
+{
+    auto offset = __result->size();
+    __result->resize(offset + max_output(__data.size()));
+    size_t count = 0;
+    bool success = update(__data.data(), __data.size(),
+        &(*__result)[offset], &count);
+    __result->resize(offset + count);
+    return success;
+}
+
+
+bool
+base64::decoder::finish(std::string* __result)
+{
+    char tail[2];
+    size_t count;
+    bool success = finish(tail, &count);
+    __result->append(tail, count);
+    return success;
+}
+
+
+void
+base64::decoder::reset() noexcept
+{
+    m_group_   = 0;
+    m_tally_   = 0;
+    m_padding_ = 0;
+    m_failed_  = false;
+}
+
+
+bool
+base64::decoder::_M_segment(
+    const char*     __data,
+    size_t          __length,
+    unsigned char** __output) noexcept
+{
+    size_t i = 0;
+    for (; i < __length && (m_tally_ || m_padding_); i++) {
+        if (!_M_push(__data[i], __output))
+            return false;
+    }
+
+    /* whole groups up to the first pad take the block decoder; if it
+       fails, the loop below redoes them and reports the exact error */
+    auto whole = (__length - i) / 4 * 4;
+    auto pad   = whole ?
+        (const char*)std::memchr(__data + i, k_pad, whole) : NULL;
+    if (pad) whole = (size_t)(pad - (__data + i)) / 4 * 4;
+    size_t count;
+    if (whole && _S_decode(__data + i, whole, *__output, &count,
+            (int)internal::simd(), m_options_)) {
+        *__output += count;
+        i         += whole;
+    }
+
+    for (; i < __length; i++) {
+        if (!_M_push(__data[i], __output))
+            return false;
+    }
     return true;
 }
 
 
-unsigned char
-base64::_S_reverse_lookup(const char __c)
+bool
+base64::decoder::_M_push(
+    char            __symbol,
+    unsigned char** __output) noexcept
 {
-    if      (__c >= 'A' && __c <= 'Z') return (unsigned char)(__c - 'A');
-    else if (__c >= 'a' && __c <= 'z') return (unsigned char)(__c - 'a' + 26);
-    else if (__c >= '0' && __c <= '9') return (unsigned char)(__c - '0' + 52);
-    else if (__c == '+')               return (unsigned char)('\x3E');
-    else if (__c == '/')               return (unsigned char)('\x3F');
-    else                               return (unsigned char)('\x40');
+    /* as in _S_decode_lenient(), only the last two pads count */
+    if (__symbol == k_pad) {
+        if (m_padding_ < 2) m_padding_++;
+        return true;
+    }
+    if (m_options_.line_length && (__symbol == '\r' || __symbol == '\n'))
+        return true;
+
+    auto value = internal::b64_tables(m_options_.url_safe)
+        .decode[3][(unsigned char)__symbol];
+    if (value & internal::base64_tables::k_bad_symbol) {
+        imp_errno = imperr::B64_BADSYM;
+        m_failed_ = true;
+        return false;
+    }
+    m_padding_ = 0;
+    m_group_   = (m_group_ << 6) | value;
+    if (++m_tally_ == 4) {
+        auto& output = *__output;
+        *output++ = (unsigned char)(m_group_ >> 16);
+        *output++ = (unsigned char)(m_group_ >> 8);
+        *output++ = (unsigned char)m_group_;
+        m_group_ = 0;
+        m_tally_ = 0;
+    }
+    return true;
 }
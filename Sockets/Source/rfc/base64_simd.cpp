@@ -0,0 +1,450 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/environment.h"
+
+#if defined(HAVE_X86_SIMD)
+
+#include <immintrin.h>
+
+#define TARGET_SSSE3  __attribute__((target("ssse3")))
+#define TARGET_AVX2   __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+/* Block kernels for rfc/base64.cpp. Each one converts as many whole
+   blocks as it can without reading or writing past the buffers the
+   scalar code was given, stops early on the first block holding a
+   symbol outside the alphabet, and returns how much input it used;
+   the scalar code finishes the tail and does all error reporting.
+
+   Encoding follows Mula's pshufb/multiply split and range lookup,
+   decoding the nibble-table validation of Klomp's library with the
+   maddubs/madd repack; AVX-512 VBMI translates through vpermb. The
+   last argument selects the URL-safe alphabet. */
+
+namespace impact {
+namespace internal {
+    size_t b64_encode_ssse3(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_encode_avx2(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_encode_avx512(const unsigned char*, size_t, char*, bool)
+        noexcept;
+    size_t b64_decode_ssse3(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+    size_t b64_decode_avx2(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+    size_t b64_decode_avx512(const unsigned char*, size_t, unsigned char*,
+        bool) noexcept;
+}}
+
+using namespace impact;
+
+namespace {
+    /* The two alphabets only differ in symbols 62 and 63, so each
+       kernel just loads a different set of lookup vectors. */
+    struct alphabet {
+        char          symbols[65];
+        /* symbol value for every 7-bit code, 0x80 where there is none */
+        unsigned char values[128];
+        /* encode: delta from index to symbol per index range */
+        signed char   offsets[16];
+        /* decode: lut_lo[low nibble] & lut_hi[high nibble] is non-zero
+           exactly for bytes outside the alphabet */
+        unsigned char lut_lo[16];
+        unsigned char lut_hi[16];
+        /* decode: delta from symbol to value per high nibble, except
+           for the one symbol that shares its row with other values */
+        signed char   lut_roll[16];
+        char          special;
+        signed char   special_fix;
+    };
+
+
+    const alphabet k_alphabets[2] = { {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+        {
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x3e, 0x80, 0x80, 0x80, 0x3f,
+            0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+            0x3c, 0x3d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+            0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+            0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+            0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+            0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+            0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+            0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+        },
+        { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+          '/' - 63, 'A', 0, 0 },
+        { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+          0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A },
+        { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+        { 0, 0, 62 - '+', 52 - '0', -'A', -'A', 26 - 'a', 26 - 'a',
+          0, 0, 0, 0, 0, 0, 0, 0 },
+        '/', (63 - '/') - (62 - '+')
+    }, {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+        {
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x3e, 0x80, 0x80,
+            0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+            0x3c, 0x3d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+            0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+            0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+            0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x3f,
+            0x80, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+            0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+            0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+            0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+        },
+        { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62,
+          '_' - 63, 'A', 0, 0 },
+        { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+          0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33 },
+        { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+        { 0, 0, 62 - '-', 52 - '0', -'A', -'A', 26 - 'a', 26 - 'a',
+          0, 0, 0, 0, 0, 0, 0, 0 },
+        '_', (63 - '_') + 'A'
+    } };
+
+
+    struct decode_luts_ssse3 {
+        __m128i lo, hi, roll, special, fix;
+    };
+
+    struct decode_luts_avx2 {
+        __m256i lo, hi, roll, special, fix;
+    };
+
+
+    inline TARGET_SSSE3 __m128i
+    load_ssse3(const void* __table)
+    {
+        return _mm_loadu_si128((const __m128i*)__table);
+    }
+
+
+    inline TARGET_AVX2 __m256i
+    load_avx2(const void* __table)
+    {
+        return _mm256_broadcastsi128_si256(load_ssse3(__table));
+    }
+
+
+    /* 3 bytes per 32-bit lane in, four 6-bit indices per lane out */
+    inline TARGET_SSSE3 __m128i
+    enc_split_ssse3(__m128i __in)
+    {
+        auto t0 = _mm_and_si128(__in, _mm_set1_epi32(0x0fc0fc00));
+        auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        auto t2 = _mm_and_si128(__in, _mm_set1_epi32(0x003f03f0));
+        auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(t1, t3);
+    }
+
+
+    /* index -> symbol by adding a per-range offset */
+    inline TARGET_SSSE3 __m128i
+    enc_translate_ssse3(
+        __m128i __indices,
+        __m128i __offsets)
+    {
+        auto range = _mm_subs_epu8(__indices, _mm_set1_epi8(51));
+        auto upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), __indices);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+        return _mm_add_epi8(__indices, _mm_shuffle_epi8(__offsets, range));
+    }
+
+
+    inline TARGET_AVX2 __m256i
+    enc_split_avx2(__m256i __in)
+    {
+        auto t0 = _mm256_and_si256(__in, _mm256_set1_epi32(0x0fc0fc00));
+        auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        auto t2 = _mm256_and_si256(__in, _mm256_set1_epi32(0x003f03f0));
+        auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        return _mm256_or_si256(t1, t3);
+    }
+
+
+    inline TARGET_AVX2 __m256i
+    enc_translate_avx2(
+        __m256i __indices,
+        __m256i __offsets)
+    {
+        auto range = _mm256_subs_epu8(__indices, _mm256_set1_epi8(51));
+        auto upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), __indices);
+        range = _mm256_or_si256(range,
+            _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        return _mm256_add_epi8(__indices,
+            _mm256_shuffle_epi8(__offsets, range));
+    }
+
+
+    /* symbols -> 6-bit values; false when any byte is not a symbol */
+    inline TARGET_SSSE3 bool
+    dec_translate_ssse3(
+        __m128i*                 __in,
+        const decode_luts_ssse3& __luts)
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        auto hi_nibbles = _mm_and_si128(_mm_srli_epi32(*__in, 4), nibble);
+        auto lo_nibbles = _mm_and_si128(*__in, nibble);
+        auto hi = _mm_shuffle_epi8(__luts.hi, hi_nibbles);
+        auto lo = _mm_shuffle_epi8(__luts.lo, lo_nibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi),
+                _mm_setzero_si128())))
+            return false;
+
+        auto roll = _mm_shuffle_epi8(__luts.roll, hi_nibbles);
+        auto fix  = _mm_and_si128(_mm_cmpeq_epi8(*__in, __luts.special),
+            __luts.fix);
+        *__in = _mm_add_epi8(*__in, _mm_add_epi8(roll, fix));
+        return true;
+    }
+
+
+    /* four 6-bit values per lane -> 3 bytes, packed to the front */
+    inline TARGET_SSSE3 __m128i
+    dec_pack_ssse3(__m128i __values)
+    {
+        auto pairs = _mm_maddubs_epi16(__values, _mm_set1_epi32(0x01400140));
+        auto quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        return _mm_shuffle_epi8(quads, _mm_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+
+    inline TARGET_AVX2 bool
+    dec_translate_avx2(
+        __m256i*                __in,
+        const decode_luts_avx2& __luts)
+    {
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        auto hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(*__in, 4),
+            nibble);
+        auto lo_nibbles = _mm256_and_si256(*__in, nibble);
+        auto hi = _mm256_shuffle_epi8(__luts.hi, hi_nibbles);
+        auto lo = _mm256_shuffle_epi8(__luts.lo, lo_nibbles);
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_and_si256(lo, hi),
+                _mm256_setzero_si256())))
+            return false;
+
+        auto roll = _mm256_shuffle_epi8(__luts.roll, hi_nibbles);
+        auto fix  = _mm256_and_si256(
+            _mm256_cmpeq_epi8(*__in, __luts.special), __luts.fix);
+        *__in = _mm256_add_epi8(*__in, _mm256_add_epi8(roll, fix));
+        return true;
+    }
+
+
+    /* 24 bytes packed to the front; the last 8 are garbage */
+    inline TARGET_AVX2 __m256i
+    dec_pack_avx2(__m256i __values)
+    {
+        auto pairs = _mm256_maddubs_epi16(__values,
+            _mm256_set1_epi32(0x01400140));
+        auto quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        auto lanes = _mm256_shuffle_epi8(quads, _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        return _mm256_permutevar8x32_epi32(lanes,
+            _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    }
+}
+
+
+TARGET_SSSE3 size_t
+internal::b64_encode_ssse3(
+    const unsigned char* __data,
+    size_t               __length,
+    char*                __result,
+    bool                 __url) noexcept
+{
+    /* big-endian 16-bit pairs of each 3-byte group, one per lane */
+    const __m128i spread = _mm_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i offsets = load_ssse3(k_alphabets[__url].offsets);
+
+    /* loads 16 bytes to use 12 */
+    size_t i = 0;
+    for (; i + 16 <= __length; i += 12, __result += 16) {
+        auto in = _mm_loadu_si128((const __m128i*)(__data + i));
+        in = _mm_shuffle_epi8(in, spread);
+        _mm_storeu_si128((__m128i*)__result,
+            enc_translate_ssse3(enc_split_ssse3(in), offsets));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::b64_encode_avx2(
+    const unsigned char* __data,
+    size_t               __length,
+    char*                __result,
+    bool                 __url) noexcept
+{
+    const __m256i spread = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = load_avx2(k_alphabets[__url].offsets);
+
+    /* 12 bytes into each 128-bit lane; the last load ends 4 past */
+    size_t i = 0;
+    for (; i + 28 <= __length; i += 24, __result += 32) {
+        auto in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i*)(__data + i))),
+            _mm_loadu_si128((const __m128i*)(__data + i + 12)), 1);
+        in = _mm256_shuffle_epi8(in, spread);
+        _mm256_storeu_si256((__m256i*)__result,
+            enc_translate_avx2(enc_split_avx2(in), offsets));
+    }
+    return i + b64_encode_ssse3(__data + i, __length - i, __result, __url);
+}
+
+
+TARGET_AVX512 size_t
+internal::b64_encode_avx512(
+    const unsigned char* __data,
+    size_t               __length,
+    char*                __result,
+    bool                 __url) noexcept
+{
+    /* bytes 1,0,2,1 of every 3-byte group, as in the narrow kernels */
+    const __m512i spread = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0a0b090a,
+        0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+        0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122,
+        0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e);
+    /* bit offsets of the four 6-bit fields in each 64-bit lane */
+    const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+    const __m512i symbols = _mm512_loadu_si512(k_alphabets[__url].symbols);
+    const __mmask64 bytes48 = 0x0000FFFFFFFFFFFFULL;
+    /* the unmasked forms trip GCC 12's -Wmaybe-uninitialized */
+    const __mmask64 all = ~0ULL;
+
+    size_t i = 0;
+    for (; i + 48 <= __length; i += 48, __result += 64) {
+        auto in = _mm512_maskz_loadu_epi8(bytes48, __data + i);
+        in = _mm512_maskz_permutexvar_epi8(all, spread, in);
+        auto indices = _mm512_maskz_multishift_epi64_epi8(all, shifts, in);
+        _mm512_storeu_si512(__result,
+            _mm512_maskz_permutexvar_epi8(all, indices, symbols));
+    }
+    return i + b64_encode_avx2(__data + i, __length - i, __result, __url);
+}
+
+
+TARGET_SSSE3 size_t
+internal::b64_decode_ssse3(
+    const unsigned char* __data,
+    size_t               __length,
+    unsigned char*       __result,
+    bool                 __url) noexcept
+{
+    const auto& table = k_alphabets[__url];
+    decode_luts_ssse3 luts;
+    luts.lo      = load_ssse3(table.lut_lo);
+    luts.hi      = load_ssse3(table.lut_hi);
+    luts.roll    = load_ssse3(table.lut_roll);
+    luts.special = _mm_set1_epi8(table.special);
+    luts.fix     = _mm_set1_epi8(table.special_fix);
+
+    /* each store writes 4 bytes past its 12; stay 24 symbols short of
+       the end so they land inside the caller's decoded_size() buffer */
+    size_t i = 0;
+    for (; i + 24 <= __length; i += 16, __result += 12) {
+        auto in = _mm_loadu_si128((const __m128i*)(__data + i));
+        if (!dec_translate_ssse3(&in, luts))
+            break;
+        _mm_storeu_si128((__m128i*)__result, dec_pack_ssse3(in));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::b64_decode_avx2(
+    const unsigned char* __data,
+    size_t               __length,
+    unsigned char*       __result,
+    bool                 __url) noexcept
+{
+    const auto& table = k_alphabets[__url];
+    decode_luts_avx2 luts;
+    luts.lo      = load_avx2(table.lut_lo);
+    luts.hi      = load_avx2(table.lut_hi);
+    luts.roll    = load_avx2(table.lut_roll);
+    luts.special = _mm256_set1_epi8(table.special);
+    luts.fix     = _mm256_set1_epi8(table.special_fix);
+
+    /* 8 bytes of slack per store, as above */
+    size_t i = 0;
+    for (; i + 48 <= __length; i += 32, __result += 24) {
+        auto in = _mm256_loadu_si256((const __m256i*)(__data + i));
+        if (!dec_translate_avx2(&in, luts))
+            return i;
+        _mm256_storeu_si256((__m256i*)__result, dec_pack_avx2(in));
+    }
+    return i + b64_decode_ssse3(__data + i, __length - i, __result, __url);
+}
+
+
+TARGET_AVX512 size_t
+internal::b64_decode_avx512(
+    const unsigned char* __data,
+    size_t               __length,
+    unsigned char*       __result,
+    bool                 __url) noexcept
+{
+    const auto& table = k_alphabets[__url];
+    const __m512i values_lo = _mm512_loadu_si512(table.values);
+    const __m512i values_hi = _mm512_loadu_si512(table.values + 64);
+    /* bytes 2,1,0 of every 32-bit lane after the repack */
+    const __m512i gather = _mm512_setr_epi32(
+        0x06000102, 0x090a0405, 0x0c0d0e08, 0x16101112,
+        0x191a1415, 0x1c1d1e18, 0x26202122, 0x292a2425,
+        0x2c2d2e28, 0x36303132, 0x393a3435, 0x3c3d3e38,
+        0, 0, 0, 0);
+    const __mmask64 bytes48 = 0x0000FFFFFFFFFFFFULL;
+    const __mmask64 all = ~0ULL;
+
+    size_t i = 0;
+    for (; i + 64 <= __length; i += 64, __result += 48) {
+        auto in = _mm512_loadu_si512(__data + i);
+        /* vpermb2 looks at 7 bits; bit 7 of the input is checked too */
+        auto values = _mm512_permutex2var_epi8(values_lo, in, values_hi);
+        if (_mm512_movepi8_mask(_mm512_or_si512(values, in)))
+            return i;
+        auto pairs = _mm512_maddubs_epi16(values,
+            _mm512_set1_epi32(0x01400140));
+        auto quads = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00011000));
+        _mm512_mask_storeu_epi8(__result, bytes48,
+            _mm512_maskz_permutexvar_epi8(all, gather, quads));
+    }
+    return i + b64_decode_avx2(__data + i, __length - i, __result, __url);
+}
+
+#endif /* HAVE_X86_SIMD */
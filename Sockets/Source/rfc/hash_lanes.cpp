@@ -0,0 +1,452 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "utils/bit_ops.h"
+#include "utils/hash_lanes.h"
+
+#if defined(HAVE_X86_SIMD)
+    #include <immintrin.h>
+#endif
+
+/* Multi-buffer md5 and sha1 for batches of small messages: every SIMD
+   lane carries a different message, so the rounds run once for 4, 8
+   or 16 blocks. A lane that runs out of blocks emits its digest and
+   picks up the next message; the padding of each message's last block
+   is built in the lane, never in a copy of the message. */
+
+using namespace impact;
+
+namespace {
+    /* state holds word w of lane l at [w * lanes + l] and words the
+       block as 16 rows laid out the same way, already in host order */
+    typedef void (*lanes_kernel)(std::uint32_t* state,
+        const std::uint32_t* words);
+
+    const size_t k_max_lanes = 16;
+
+    const std::uint32_t k_md5_initial[4] = {
+        0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476
+    };
+    const std::uint32_t k_sha1_initial[5] = {
+        0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0
+    };
+
+
+    /* lane kernels only exist for x86, so host words are little
+       endian; sha1 reads and writes big-endian ones */
+    inline std::uint32_t
+    load_word(
+        const unsigned char* __bytes,
+        bool                 __big_endian) noexcept
+    {
+        std::uint32_t word;
+        std::memcpy(&word, __bytes, sizeof(word));
+        return __big_endian ? internal::byte_swap_32(word) : word;
+    }
+
+
+    struct lane {
+        const unsigned char* data;    /* next block to hash         */
+        size_t               whole;   /* blocks left in the message */
+        size_t               padded;  /* blocks left in tail        */
+        size_t               message; /* index into results         */
+        unsigned char        tail[128];
+
+        /* the bytes past the last whole block, 0x80, zeros and the bit
+           length, little endian for md5 and big endian for sha1 */
+        void start(const void* __data, size_t __length, size_t __message,
+            bool __big_endian) noexcept {
+            auto rest = __length % 64;
+            auto size = rest < 56 ? 64 : 128;
+            whole   = __length / 64;
+            padded  = size / 64;
+            message = __message;
+            data    = whole ? (const unsigned char*)__data : tail;
+            std::memset(tail, 0, size);
+            if (rest) std::memcpy(tail,
+                (const unsigned char*)__data + whole * 64, rest);
+            tail[rest] = 0x80;
+            auto bits = (std::uint64_t)__length << 3;
+            if (__big_endian) bits = internal::byte_swap_64(bits);
+            std::memcpy(tail + size - 8, &bits, sizeof(bits));
+        }
+
+        /* false once the last block has been hashed */
+        bool advance() noexcept {
+            if (whole) {
+                data = --whole ? data + 64 : tail;
+                return true;
+            }
+            data += 64;
+            return --padded != 0;
+        }
+    };
+
+
+#if defined(HAVE_X86_SIMD)
+
+#define TARGET_SSSE3  __attribute__((target("ssse3")))
+#define TARGET_AVX2   __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+
+    /* The round code below is written once, as macros over these
+       overloads; each kernel expands it for its own vector width. */
+
+    TARGET_SSSE3 inline __m128i
+    v_add(__m128i __a, __m128i __b) { return _mm_add_epi32(__a, __b); }
+    TARGET_SSSE3 inline __m128i
+    v_xor(__m128i __a, __m128i __b) { return _mm_xor_si128(__a, __b); }
+    TARGET_SSSE3 inline __m128i
+    v_rotl(__m128i __a, int __bits) {
+        return _mm_or_si128(_mm_slli_epi32(__a, __bits),
+            _mm_srli_epi32(__a, 32 - __bits));
+    }
+    /* z ^ (x & (y ^ z)) */
+    TARGET_SSSE3 inline __m128i
+    v_choose(__m128i __x, __m128i __y, __m128i __z) {
+        return _mm_xor_si128(__z, _mm_and_si128(__x, _mm_xor_si128(__y, __z)));
+    }
+    TARGET_SSSE3 inline __m128i
+    v_parity(__m128i __x, __m128i __y, __m128i __z) {
+        return _mm_xor_si128(__x, _mm_xor_si128(__y, __z));
+    }
+    /* (x & y) | (z & (x | y)) */
+    TARGET_SSSE3 inline __m128i
+    v_majority(__m128i __x, __m128i __y, __m128i __z) {
+        return _mm_or_si128(_mm_and_si128(__x, __y),
+            _mm_and_si128(__z, _mm_or_si128(__x, __y)));
+    }
+    /* y ^ (x | ~z) */
+    TARGET_SSSE3 inline __m128i
+    v_md5_i(__m128i __x, __m128i __y, __m128i __z) {
+        return _mm_xor_si128(__y, _mm_or_si128(__x,
+            _mm_xor_si128(__z, _mm_set1_epi32(-1))));
+    }
+
+
+    TARGET_AVX2 inline __m256i
+    v_add(__m256i __a, __m256i __b) { return _mm256_add_epi32(__a, __b); }
+    TARGET_AVX2 inline __m256i
+    v_xor(__m256i __a, __m256i __b) { return _mm256_xor_si256(__a, __b); }
+    TARGET_AVX2 inline __m256i
+    v_rotl(__m256i __a, int __bits) {
+        return _mm256_or_si256(_mm256_slli_epi32(__a, __bits),
+            _mm256_srli_epi32(__a, 32 - __bits));
+    }
+    TARGET_AVX2 inline __m256i
+    v_choose(__m256i __x, __m256i __y, __m256i __z) {
+        return _mm256_xor_si256(__z,
+            _mm256_and_si256(__x, _mm256_xor_si256(__y, __z)));
+    }
+    TARGET_AVX2 inline __m256i
+    v_parity(__m256i __x, __m256i __y, __m256i __z) {
+        return _mm256_xor_si256(__x, _mm256_xor_si256(__y, __z));
+    }
+    TARGET_AVX2 inline __m256i
+    v_majority(__m256i __x, __m256i __y, __m256i __z) {
+        return _mm256_or_si256(_mm256_and_si256(__x, __y),
+            _mm256_and_si256(__z, _mm256_or_si256(__x, __y)));
+    }
+    TARGET_AVX2 inline __m256i
+    v_md5_i(__m256i __x, __m256i __y, __m256i __z) {
+        return _mm256_xor_si256(__y, _mm256_or_si256(__x,
+            _mm256_xor_si256(__z, _mm256_set1_epi32(-1))));
+    }
+
+
+    /* three-input functions are one vpternlogd each */
+    TARGET_AVX512 inline __m512i
+    v_add(__m512i __a, __m512i __b) { return _mm512_add_epi32(__a, __b); }
+    TARGET_AVX512 inline __m512i
+    v_xor(__m512i __a, __m512i __b) { return _mm512_xor_si512(__a, __b); }
+    TARGET_AVX512 inline __m512i
+    v_rotl(__m512i __a, int __bits) {
+        /* the unmasked form trips GCC 12's uninitialised warning */
+        return _mm512_maskz_rolv_epi32((__mmask16)0xFFFF, __a,
+            _mm512_set1_epi32(__bits));
+    }
+    TARGET_AVX512 inline __m512i
+    v_choose(__m512i __x, __m512i __y, __m512i __z) {
+        return _mm512_ternarylogic_epi32(__x, __y, __z, 0xCA);
+    }
+    TARGET_AVX512 inline __m512i
+    v_parity(__m512i __x, __m512i __y, __m512i __z) {
+        return _mm512_ternarylogic_epi32(__x, __y, __z, 0x96);
+    }
+    TARGET_AVX512 inline __m512i
+    v_majority(__m512i __x, __m512i __y, __m512i __z) {
+        return _mm512_ternarylogic_epi32(__x, __y, __z, 0xE8);
+    }
+    TARGET_AVX512 inline __m512i
+    v_md5_i(__m512i __x, __m512i __y, __m512i __z) {
+        return _mm512_ternarylogic_epi32(__x, __y, __z, 0x39);
+    }
+
+
+    const std::uint32_t k_md5_k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+    const int k_md5_shift[16] = {
+        7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21
+    };
+    const std::uint32_t k_sha1_k[4] = {
+        0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+    };
+
+
+    /* g(x, y, z) = f(z, x, y) gives md5's second round function */
+    #define MD5_LANES(V, LANES, LOAD, STORE, SET1)                      \
+        V m[16];                                                        \
+        for (int j = 0; j < 16; j++) m[j] = LOAD(__words + j * LANES);  \
+        V a = LOAD(__state),             b = LOAD(__state + LANES);     \
+        V c = LOAD(__state + 2 * LANES), d = LOAD(__state + 3 * LANES); \
+        V a0 = a, b0 = b, c0 = c, d0 = d;                               \
+        _Pragma("GCC unroll 64")                                        \
+        for (int i = 0; i < 64; i++) {                                  \
+            V f;                                                        \
+            int j;                                                      \
+            switch (i >> 4) {                                           \
+            case 0:  f = v_choose(b, c, d);   j = i;                break; \
+            case 1:  f = v_choose(d, b, c);   j = (5 * i + 1) & 15; break; \
+            case 2:  f = v_parity(b, c, d);   j = (3 * i + 5) & 15; break; \
+            default: f = v_md5_i(b, c, d);    j = (7 * i) & 15;     break; \
+            }                                                           \
+            f = v_add(v_add(a, f), v_add(m[j], SET1((int)k_md5_k[i]))); \
+            a = d; d = c; c = b;                                        \
+            b = v_add(b, v_rotl(f, k_md5_shift[(i >> 4) * 4 + (i & 3)])); \
+        }                                                               \
+        STORE(__state,             v_add(a, a0));                       \
+        STORE(__state + LANES,     v_add(b, b0));                       \
+        STORE(__state + 2 * LANES, v_add(c, c0));                       \
+        STORE(__state + 3 * LANES, v_add(d, d0));
+
+    /* the schedule lives in a ring of the last 16 words */
+    #define SHA1_LANES(V, LANES, LOAD, STORE, SET1)                     \
+        V w[16];                                                        \
+        V a = LOAD(__state),             b = LOAD(__state + LANES);     \
+        V c = LOAD(__state + 2 * LANES), d = LOAD(__state + 3 * LANES); \
+        V e = LOAD(__state + 4 * LANES);                                \
+        V a0 = a, b0 = b, c0 = c, d0 = d, e0 = e;                       \
+        _Pragma("GCC unroll 80")                                        \
+        for (int t = 0; t < 80; t++) {                                  \
+            if (t < 16) w[t] = LOAD(__words + t * LANES);               \
+            else w[t & 15] = v_rotl(v_xor(                              \
+                v_xor(w[(t - 3) & 15], w[(t - 8) & 15]),                \
+                v_xor(w[(t - 14) & 15], w[t & 15])), 1);                \
+            V f;                                                        \
+            if (t < 20)      f = v_choose(b, c, d);                     \
+            else if (t < 40) f = v_parity(b, c, d);                     \
+            else if (t < 60) f = v_majority(b, c, d);                   \
+            else             f = v_parity(b, c, d);                     \
+            V temp = v_add(v_add(v_rotl(a, 5), f), v_add(v_add(e,       \
+                w[t & 15]), SET1((int)k_sha1_k[t / 20])));              \
+            e = d; d = c; c = v_rotl(b, 30); b = a; a = temp;           \
+        }                                                               \
+        STORE(__state,             v_add(a, a0));                       \
+        STORE(__state + LANES,     v_add(b, b0));                       \
+        STORE(__state + 2 * LANES, v_add(c, c0));                       \
+        STORE(__state + 3 * LANES, v_add(d, d0));                       \
+        STORE(__state + 4 * LANES, v_add(e, e0));
+
+    #define LOAD128(p)     _mm_load_si128((const __m128i*)(p))
+    #define STORE128(p, v) _mm_store_si128((__m128i*)(p), v)
+    #define LOAD256(p)     _mm256_load_si256((const __m256i*)(p))
+    #define STORE256(p, v) _mm256_store_si256((__m256i*)(p), v)
+    #define LOAD512(p)     _mm512_load_si512((const void*)(p))
+    #define STORE512(p, v) _mm512_store_si512((void*)(p), v)
+
+
+    TARGET_SSSE3 void
+    md5_lanes_ssse3(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        MD5_LANES(__m128i, 4, LOAD128, STORE128, _mm_set1_epi32)
+    }
+
+
+    TARGET_AVX2 void
+    md5_lanes_avx2(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        MD5_LANES(__m256i, 8, LOAD256, STORE256, _mm256_set1_epi32)
+    }
+
+
+    TARGET_AVX512 void
+    md5_lanes_avx512(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        MD5_LANES(__m512i, 16, LOAD512, STORE512, _mm512_set1_epi32)
+    }
+
+
+    TARGET_SSSE3 void
+    sha1_lanes_ssse3(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        SHA1_LANES(__m128i, 4, LOAD128, STORE128, _mm_set1_epi32)
+    }
+
+
+    TARGET_AVX2 void
+    sha1_lanes_avx2(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        SHA1_LANES(__m256i, 8, LOAD256, STORE256, _mm256_set1_epi32)
+    }
+
+
+    TARGET_AVX512 void
+    sha1_lanes_avx512(
+        std::uint32_t*       __state,
+        const std::uint32_t* __words)
+    {
+        SHA1_LANES(__m512i, 16, LOAD512, STORE512, _mm512_set1_epi32)
+    }
+
+#endif /* HAVE_X86_SIMD */
+
+
+    lanes_kernel
+    kernel_for(
+        internal::lane_hash  __algorithm,
+        internal::simd_level __level,
+        size_t*              __lanes) noexcept
+    {
+        bool md5 = __algorithm == internal::lane_hash::MD5;
+        switch (__level) {
+#if defined(HAVE_X86_SIMD)
+        case internal::simd_level::SSSE3:
+            *__lanes = 4;
+            return md5 ? md5_lanes_ssse3 : sha1_lanes_ssse3;
+        case internal::simd_level::AVX2:
+            *__lanes = 8;
+            return md5 ? md5_lanes_avx2 : sha1_lanes_avx2;
+        case internal::simd_level::AVX512:
+            *__lanes = 16;
+            return md5 ? md5_lanes_avx512 : sha1_lanes_avx512;
+#endif
+        default:
+            (void)md5;
+            (void)__lanes;
+            return NULL;
+        }
+    }
+}
+
+
+bool
+internal::hash_lanes(
+    lane_hash            __algorithm,
+    const void* const*   __data,
+    const size_t*        __lengths,
+    size_t               __count,
+    unsigned char*       __results,
+    simd_level           __level) noexcept
+{
+    size_t lanes = 0;
+    auto kernel = kernel_for(__algorithm, __level, &lanes);
+    if (!kernel) return false;
+
+    const bool big_endian = __algorithm == lane_hash::SHA1;
+    const auto initial    = big_endian ? k_sha1_initial : k_md5_initial;
+    const size_t words    = big_endian ? 5 : 4;
+
+    alignas(64) std::uint32_t state[5 * k_max_lanes];
+    alignas(64) std::uint32_t block[16 * k_max_lanes];
+    static const unsigned char idle[64] = { 0 };
+    lane   slots[k_max_lanes];
+    bool   busy[k_max_lanes];
+    size_t next = 0, running = 0;
+
+    auto load = [&](size_t __lane) {
+        if (next == __count) {
+            busy[__lane] = false;
+            return;
+        }
+        slots[__lane].start(__data[next], __lengths[next], next, big_endian);
+        for (size_t w = 0; w < words; w++)
+            state[w * lanes + __lane] = initial[w];
+        busy[__lane] = true;
+        next++;
+    };
+
+    for (size_t l = 0; l < lanes; l++) {
+        load(l);
+        if (busy[l]) running++;
+    }
+
+    while (running) {
+        for (size_t l = 0; l < lanes; l++) {
+            auto input = busy[l] ? slots[l].data : idle;
+            for (size_t j = 0; j < 16; j++, input += 4)
+                block[j * lanes + l] = load_word(input, big_endian);
+        }
+
+        kernel(state, block);
+
+        for (size_t l = 0; l < lanes; l++) {
+            if (!busy[l] || slots[l].advance()) continue;
+            auto digest = __results + slots[l].message * words * 4;
+            for (size_t w = 0; w < words; w++, digest += 4) {
+                auto word = state[w * lanes + l];
+                if (big_endian) word = internal::byte_swap_32(word);
+                std::memcpy(digest, &word, sizeof(word));
+            }
+            load(l);
+            if (!busy[l]) running--;
+        }
+    }
+
+    return true;
+}
+
+
+void
+internal::digest_strings(
+    const std::string* __messages,
+    size_t             __count,
+    unsigned char*     __results,
+    size_t             __hash_size,
+    batch_digest       __digest)
+{
+    const void* data[256];
+    size_t lengths[256];
+    while (__count) {
+        size_t batch = std::min<size_t>(__count, 256);
+        for (size_t i = 0; i < batch; i++) {
+            data[i]    = __messages[i].data();
+            lengths[i] = __messages[i].size();
+        }
+        __digest(data, lengths, batch, __results);
+        __messages += batch;
+        __results  += batch * __hash_size;
+        __count    -= batch;
+    }
+}
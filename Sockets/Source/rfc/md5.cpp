@@ -4,6 +4,10 @@
 
 #include "rfc/md5.h"
 #include <algorithm>
+#include <cstring>
+
+#include "utils/cpu_features.h"
+#include "utils/hash_lanes.h"
 
 using namespace impact;
 
@@ -15,147 +19,248 @@ using namespace impact;
     #define MASK32 0xFFFFFFFF &
 #endif
 
+/* round functions and one step of each round (RFC 1321 section 3.4) */
+#define F(x, y, z) (z ^ (x & (y ^ z)))
+#define G(x, y, z) (y ^ (z & (x ^ y)))
+#define H(x, y, z) (x ^ y ^ z)
+#define I(x, y, z) (y ^ (x | (MASK32 (~z))))
+
+#define STEP(f, a, b, c, d, m, k, s)                    \
+    a = MASK32 (a + f(b, c, d) + m + k);                \
+    a = MASK32 (b + (MASK32 ((a << s) | (a >> (32 - s)))));
 
-md5::var md5::s[64] = {
-    7, 12, 17, 22,  7, 12, 17, 22,  7, 12, 17, 22,  7, 12, 17, 22,
-    5,  9, 14, 20,  5,  9, 14, 20,  5,  9, 14, 20,  5,  9, 14, 20,
-    4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,
-    6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21
-};
-
-
-md5::var md5::K[64] = {
-    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-};
+const unsigned int md5::HASH_SIZE;
 
 
 std::string
-md5::digest(std::string __message)
+md5::digest(const std::string& __message)
+{
+    md5 hasher;
+    hasher.update(__message);
+    return hasher.finalize();
+}
+
+
+void
+md5::digest(
+    const void* const* __messages,
+    const size_t*      __lengths,
+    size_t             __count,
+    unsigned char*     __results) noexcept
 {
-    _S_preprocess(&__message);
-    return _S_process(__message);
+    _S_digest(__messages, __lengths, __count, __results,
+        (int)internal::simd());
 }
 
 
 void
-md5::_S_preprocess(std::string* __message)
+md5::digest(
+    const std::string* __messages,
+    size_t             __count,
+    unsigned char*     __results) noexcept
 {
-    auto& padded_message = *__message;
-    size_t original_size = __message->size();
+    internal::digest_strings(__messages, __count, __results, HASH_SIZE,
+        digest);
+}
+
+
+void
+md5::_S_digest(
+    const void* const*   __messages,
+    const size_t*        __lengths,
+    size_t               __count,
+    unsigned char*       __results,
+    int                  __level) noexcept
+{
+    if (internal::hash_lanes(internal::lane_hash::MD5, __messages,
+        __lengths, __count, __results, (internal::simd_level)__level))
+        return;
+
+    md5 hasher;
+    for (size_t i = 0; i < __count; i++) {
+        hasher.update(__messages[i], __lengths[i]);
+        hasher.finalize(__results + i * HASH_SIZE);
+    }
+}
 
-    // TODO: safe-guard against message overflow
-    // max_size = size + roundup(size % 512)
 
-    size_t zero_pad_length;
-    size_t modulo1 = (original_size + 1) % 64;
-    if (modulo1 <= 56) zero_pad_length =  56 - modulo1;
-    else               zero_pad_length = 120 - modulo1;
+md5::md5() noexcept
+{
+    reset();
+}
 
-    padded_message.append("\x80");
-    padded_message.append(zero_pad_length + 8, '\0');
 
-	original_size <<= 3; // get size in bits
-    unsigned int sizeof_size_t = std::min(sizeof(size_t), (size_t)8U);
-    char* trailer = &padded_message[padded_message.size() - 8];
-    for (unsigned int i = 0; i < sizeof_size_t; i++)
-        trailer[i] = 0xFF & (original_size >> (8 * i));
+void
+md5::reset() noexcept
+{
+    m_state_[0] = 0x67452301; // A
+    m_state_[1] = 0xefcdab89; // B
+    m_state_[2] = 0x98badcfe; // C
+    m_state_[3] = 0x10325476; // D
+    m_length_   = 0;
+}
+
+
+void
+md5::update(
+    const void* __data,
+    size_t      __length) noexcept
+{
+    if (!__length) return;
+    auto input    = (const unsigned char*)__data;
+    auto buffered = (size_t)(m_length_ % 64);
+    m_length_    += __length;
+
+    /* top up a partial block first, then hash whole blocks straight
+       from the caller's memory and keep only the remainder */
+    if (buffered) {
+        size_t count = std::min<size_t>(__length, 64 - buffered);
+        std::memcpy(m_block_ + buffered, input, count);
+        input    += count;
+        __length -= count;
+        if (buffered + count < 64) return;
+        _S_transform(m_state_, m_block_);
+    }
+
+    for (; __length >= 64; __length -= 64, input += 64)
+        _S_transform(m_state_, input);
+
+    if (__length) std::memcpy(m_block_, input, __length);
+}
+
+
+void
+md5::update(const std::string& __data) noexcept
+{
+    update(__data.data(), __data.size());
+}
+
+
+void
+md5::finalize(unsigned char* __result) noexcept
+{
+    /* 0x80, zeros up to 56 mod 64, then the length in bits */
+    unsigned char trailer[72] = { 0x80 };
+    auto bits     = m_length_ << 3;
+    auto buffered = (size_t)(m_length_ % 64);
+    size_t length = (buffered < 56 ? 56 : 120) - buffered;
+    for (unsigned int i = 0; i < 8; i++)
+        trailer[length + i] = MASK8 (bits >> (8 * i));
+    update(trailer, length + 8);
+
+    for (unsigned int i = 0; i < HASH_SIZE; i++) {
+        __result[i] = (unsigned char)
+            (MASK8 (m_state_[i >> 2] >> 8 * (i & 3)));
+    }
+
+    reset();
 }
 
 
 std::string
-md5::_S_process(const std::string& __padded_message)
+md5::finalize()
+{
+    unsigned char result[HASH_SIZE];
+    finalize(result);
+    return std::string((const char*)result, HASH_SIZE);
+}
+
+
+void
+md5::_S_transform(
+    var*                 __state,
+    const unsigned char* __block) noexcept
 {
-    var a0 = 0x67452301; // A
-    var b0 = 0xefcdab89; // B
-    var c0 = 0x98badcfe; // C
-    var d0 = 0x10325476; // D
-
-    for (size_t chunk_index = 0;
-        chunk_index < __padded_message.size();
-        chunk_index += 64)
-    {
-        // Break chunk into sixteen 32-bit words M[j], 0 ≤ j ≤ 15
-        var M[16];
-        for (unsigned int j = 0; j < 16; j++) {
-            M[j] =
-                ((MASK8 __padded_message[chunk_index + (j * 4) + 0]) <<  0) |
-                ((MASK8 __padded_message[chunk_index + (j * 4) + 1]) <<  8) |
-                ((MASK8 __padded_message[chunk_index + (j * 4) + 2]) << 16) |
-                ((MASK8 __padded_message[chunk_index + (j * 4) + 3]) << 24);
-        }
-
-        var A = a0;
-        var B = b0;
-        var C = c0;
-        var D = d0;
-
-        // Main loop:
-        for (var i = 0; i < 64; i++) {
-            var F, j;
-            if ((0 == i || 0 < i) && i <= 15) {
-                F = MASK32 ((B & C) | ((MASK32 (~B)) & D));
-                j = i;
-            }
-            else if (16 <= i && i <= 31) {
-                F = MASK32 ((B & D) | (C & (MASK32 (~D))));
-                j = (5 * i + 1) % 16;
-            }
-            else if (32 <= i && i <= 47) {
-                F = MASK32 (B ^ C ^ D);
-                j = (3 * i + 5) % 16;
-            }
-            else /* if (48 <= i && i <= 63) */ {
-                F = MASK32 (C ^ (B | (MASK32 (~D))));
-                j = (7 * i) % 16;
-            }
-
-            // Be wary of the below definitions of a,b,c,d
-            F = MASK32 (F + A + K[i] + M[j]);
-            F = MASK32 ((F << s[i]) | (F >> (32 - s[i]))); // left-rotate
-            A = D;
-            D = C;
-            C = B;
-            B = MASK32 (B + F);
-        }
-
-        // Add this chunk's hash to result so far:
-        a0 = MASK32 (a0 + A);
-        b0 = MASK32 (b0 + B);
-        c0 = MASK32 (c0 + C);
-        d0 = MASK32 (d0 + D);
+    // Break chunk into sixteen 32-bit words M[j], 0 ≤ j ≤ 15
+    var M[16];
+    for (unsigned int j = 0; j < 16; j++) {
+        M[j] =
+            ((var)__block[(j * 4) + 0] <<  0) |
+            ((var)__block[(j * 4) + 1] <<  8) |
+            ((var)__block[(j * 4) + 2] << 16) |
+            ((var)__block[(j * 4) + 3] << 24);
     }
 
-    std::string result(16, '\0');
-    result[ 0] = (char)(MASK8 (a0 >>  0));
-    result[ 1] = (char)(MASK8 (a0 >>  8));
-    result[ 2] = (char)(MASK8 (a0 >> 16));
-    result[ 3] = (char)(MASK8 (a0 >> 24));
-    result[ 4] = (char)(MASK8 (b0 >>  0));
-    result[ 5] = (char)(MASK8 (b0 >>  8));
-    result[ 6] = (char)(MASK8 (b0 >> 16));
-    result[ 7] = (char)(MASK8 (b0 >> 24));
-    result[ 8] = (char)(MASK8 (c0 >>  0));
-    result[ 9] = (char)(MASK8 (c0 >>  8));
-    result[10] = (char)(MASK8 (c0 >> 16));
-    result[11] = (char)(MASK8 (c0 >> 24));
-    result[12] = (char)(MASK8 (d0 >>  0));
-    result[13] = (char)(MASK8 (d0 >>  8));
-    result[14] = (char)(MASK8 (d0 >> 16));
-    result[15] = (char)(MASK8 (d0 >> 24));
-    return result;
+    var A = __state[0];
+    var B = __state[1];
+    var C = __state[2];
+    var D = __state[3];
+
+    // Round 1: M[i]
+    STEP(F, A, B, C, D, M[ 0], 0xd76aa478,  7)
+    STEP(F, D, A, B, C, M[ 1], 0xe8c7b756, 12)
+    STEP(F, C, D, A, B, M[ 2], 0x242070db, 17)
+    STEP(F, B, C, D, A, M[ 3], 0xc1bdceee, 22)
+    STEP(F, A, B, C, D, M[ 4], 0xf57c0faf,  7)
+    STEP(F, D, A, B, C, M[ 5], 0x4787c62a, 12)
+    STEP(F, C, D, A, B, M[ 6], 0xa8304613, 17)
+    STEP(F, B, C, D, A, M[ 7], 0xfd469501, 22)
+    STEP(F, A, B, C, D, M[ 8], 0x698098d8,  7)
+    STEP(F, D, A, B, C, M[ 9], 0x8b44f7af, 12)
+    STEP(F, C, D, A, B, M[10], 0xffff5bb1, 17)
+    STEP(F, B, C, D, A, M[11], 0x895cd7be, 22)
+    STEP(F, A, B, C, D, M[12], 0x6b901122,  7)
+    STEP(F, D, A, B, C, M[13], 0xfd987193, 12)
+    STEP(F, C, D, A, B, M[14], 0xa679438e, 17)
+    STEP(F, B, C, D, A, M[15], 0x49b40821, 22)
+
+    // Round 2: M[(5i + 1) % 16]
+    STEP(G, A, B, C, D, M[ 1], 0xf61e2562,  5)
+    STEP(G, D, A, B, C, M[ 6], 0xc040b340,  9)
+    STEP(G, C, D, A, B, M[11], 0x265e5a51, 14)
+    STEP(G, B, C, D, A, M[ 0], 0xe9b6c7aa, 20)
+    STEP(G, A, B, C, D, M[ 5], 0xd62f105d,  5)
+    STEP(G, D, A, B, C, M[10], 0x02441453,  9)
+    STEP(G, C, D, A, B, M[15], 0xd8a1e681, 14)
+    STEP(G, B, C, D, A, M[ 4], 0xe7d3fbc8, 20)
+    STEP(G, A, B, C, D, M[ 9], 0x21e1cde6,  5)
+    STEP(G, D, A, B, C, M[14], 0xc33707d6,  9)
+    STEP(G, C, D, A, B, M[ 3], 0xf4d50d87, 14)
+    STEP(G, B, C, D, A, M[ 8], 0x455a14ed, 20)
+    STEP(G, A, B, C, D, M[13], 0xa9e3e905,  5)
+    STEP(G, D, A, B, C, M[ 2], 0xfcefa3f8,  9)
+    STEP(G, C, D, A, B, M[ 7], 0x676f02d9, 14)
+    STEP(G, B, C, D, A, M[12], 0x8d2a4c8a, 20)
+
+    // Round 3: M[(3i + 5) % 16]
+    STEP(H, A, B, C, D, M[ 5], 0xfffa3942,  4)
+    STEP(H, D, A, B, C, M[ 8], 0x8771f681, 11)
+    STEP(H, C, D, A, B, M[11], 0x6d9d6122, 16)
+    STEP(H, B, C, D, A, M[14], 0xfde5380c, 23)
+    STEP(H, A, B, C, D, M[ 1], 0xa4beea44,  4)
+    STEP(H, D, A, B, C, M[ 4], 0x4bdecfa9, 11)
+    STEP(H, C, D, A, B, M[ 7], 0xf6bb4b60, 16)
+    STEP(H, B, C, D, A, M[10], 0xbebfbc70, 23)
+    STEP(H, A, B, C, D, M[13], 0x289b7ec6,  4)
+    STEP(H, D, A, B, C, M[ 0], 0xeaa127fa, 11)
+    STEP(H, C, D, A, B, M[ 3], 0xd4ef3085, 16)
+    STEP(H, B, C, D, A, M[ 6], 0x04881d05, 23)
+    STEP(H, A, B, C, D, M[ 9], 0xd9d4d039,  4)
+    STEP(H, D, A, B, C, M[12], 0xe6db99e5, 11)
+    STEP(H, C, D, A, B, M[15], 0x1fa27cf8, 16)
+    STEP(H, B, C, D, A, M[ 2], 0xc4ac5665, 23)
+
+    // Round 4: M[7i % 16]
+    STEP(I, A, B, C, D, M[ 0], 0xf4292244,  6)
+    STEP(I, D, A, B, C, M[ 7], 0x432aff97, 10)
+    STEP(I, C, D, A, B, M[14], 0xab9423a7, 15)
+    STEP(I, B, C, D, A, M[ 5], 0xfc93a039, 21)
+    STEP(I, A, B, C, D, M[12], 0x655b59c3,  6)
+    STEP(I, D, A, B, C, M[ 3], 0x8f0ccc92, 10)
+    STEP(I, C, D, A, B, M[10], 0xffeff47d, 15)
+    STEP(I, B, C, D, A, M[ 1], 0x85845dd1, 21)
+    STEP(I, A, B, C, D, M[ 8], 0x6fa87e4f,  6)
+    STEP(I, D, A, B, C, M[15], 0xfe2ce6e0, 10)
+    STEP(I, C, D, A, B, M[ 6], 0xa3014314, 15)
+    STEP(I, B, C, D, A, M[13], 0x4e0811a1, 21)
+    STEP(I, A, B, C, D, M[ 4], 0xf7537e82,  6)
+    STEP(I, D, A, B, C, M[11], 0xbd3af235, 10)
+    STEP(I, C, D, A, B, M[ 2], 0x2ad7d2bb, 15)
+    STEP(I, B, C, D, A, M[ 9], 0xeb86d391, 21)
+
+    // Add this chunk's hash to result so far:
+    __state[0] = MASK32 (__state[0] + A);
+    __state[1] = MASK32 (__state[1] + B);
+    __state[2] = MASK32 (__state[2] + C);
+    __state[3] = MASK32 (__state[3] + D);
 }
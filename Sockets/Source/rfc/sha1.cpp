@@ -7,45 +7,186 @@
 
 #include "rfc/sha1.h"
 
+#include <cstdint>
+#include <cstring>
+
+#include "utils/cpu_features.h"
+#include "utils/hash_lanes.h"
 #include "utils/impact_error.h"
 
 using namespace impact;
 
+namespace impact {
+namespace internal {
+    /* block kernels (rfc/sha1_simd.cpp) */
+    typedef void (*sha1_kernel)(std::uint32_t*, const unsigned char*,
+        size_t);
+    sha1_kernel sha1_blocks_kernel(simd_level level, bool sha_ni) noexcept;
+    /* the SHA extensions are used whenever SIMD is not capped off */
+    bool sha1_ni() noexcept;
+
+#if defined(HAVE_X86_SIMD)
+    void sha1_blocks_ssse3(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+    void sha1_blocks_avx2(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+    void sha1_blocks_sha(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+#endif
+}}
+
 #define circular_shift(bits,word) \
                 (((word) << (bits)) | ((word) >> (32-(bits))))
 
-const unsigned int sha1::HASH_SIZE = 20;
+const unsigned int sha1::HASH_SIZE;
+
+
+internal::sha1_kernel
+internal::sha1_blocks_kernel(
+    simd_level __level,
+    bool       __sha_ni) noexcept
+{
+#if defined(HAVE_X86_SIMD)
+    if (__sha_ni) return sha1_blocks_sha;
+    switch (__level) {
+    case simd_level::SSSE3:  return sha1_blocks_ssse3;
+    case simd_level::AVX2:
+    case simd_level::AVX512: return sha1_blocks_avx2;
+    default: return NULL;
+    }
+#else
+    (void)__level;
+    (void)__sha_ni;
+    return NULL;
+#endif
+}
+
+
+bool
+internal::sha1_ni() noexcept
+{
+    static const bool enabled = simd() != simd_level::SCALAR &&
+        cpu().sha && cpu().ssse3 && cpu().sse41;
+    return enabled;
+}
 
 
 std::string
-sha1::digest(std::string __message)
+sha1::digest(const std::string& __message)
 {
-    struct context ctx;
-    STATUS status;
-    unsigned char message_digest[HASH_SIZE];
-    
-    status = _S_reset(&ctx);
-    if (status != STATUS::SUCCESS)
-        throw impact_error("something unexpected happened"); // reset error
+    sha1 hasher;
+    hasher.update(__message);
+    return hasher.finalize();
+}
 
-    status = _S_input(&ctx, (const unsigned char*)__message.c_str(),
-        __message.length());
-    switch (status) {
-    case STATUS::NIL:
-    case STATUS::STATE_ERROR:    throw impact_error("internal error"); break;
-    case STATUS::INPUT_TOO_LONG: throw impact_error("input too long"); break;
-    default: /* success */ break;
+
+void
+sha1::digest(
+    const void* const* __messages,
+    const size_t*      __lengths,
+    size_t             __count,
+    unsigned char*     __results)
+{
+    /* up front, so neither the lanes nor the fallback stop halfway */
+    for (size_t i = 0; i < __count; i++)
+        if ((std::uint64_t)__lengths[i] > UINT64_MAX / 8)
+            _S_check(STATUS::INPUT_TOO_LONG);
+
+    /* four lanes lose to the SHA extensions one message at a time */
+    auto level = internal::simd();
+    if (level == internal::simd_level::SSSE3 && internal::sha1_ni())
+        level = internal::simd_level::SCALAR;
+    _S_digest(__messages, __lengths, __count, __results, (int)level);
+}
+
+
+void
+sha1::digest(
+    const std::string* __messages,
+    size_t             __count,
+    unsigned char*     __results)
+{
+    internal::digest_strings(__messages, __count, __results, HASH_SIZE,
+        digest);
+}
+
+
+void
+sha1::_S_digest(
+    const void* const*   __messages,
+    const size_t*        __lengths,
+    size_t               __count,
+    unsigned char*       __results,
+    int                  __level)
+{
+    if (internal::hash_lanes(internal::lane_hash::SHA1, __messages,
+        __lengths, __count, __results, (internal::simd_level)__level))
+        return;
+
+    sha1 hasher;
+    for (size_t i = 0; i < __count; i++) {
+        hasher.update(__messages[i], __lengths[i]);
+        hasher.finalize(__results + i * HASH_SIZE);
     }
-    
-    status = _S_result(&ctx, (unsigned char*)message_digest);
-    switch (status) {
+}
+
+
+sha1::sha1() noexcept
+{
+    _S_reset(&m_context_);
+}
+
+
+void
+sha1::update(
+    const void* __data,
+    size_t      __length)
+{
+    _S_check(_S_input(&m_context_, (const unsigned char*)__data, __length));
+}
+
+
+void
+sha1::update(const std::string& __data)
+{
+    update(__data.data(), __data.size());
+}
+
+
+void
+sha1::finalize(unsigned char* __result)
+{
+    auto status = _S_result(&m_context_, __result);
+    _S_reset(&m_context_);
+    _S_check(status);
+}
+
+
+std::string
+sha1::finalize()
+{
+    unsigned char message_digest[HASH_SIZE];
+    finalize(message_digest);
+    return std::string((const char*)(message_digest), HASH_SIZE);
+}
+
+
+void
+sha1::reset() noexcept
+{
+    _S_reset(&m_context_);
+}
+
+
+void
+sha1::_S_check(STATUS __status)
+{
+    switch (__status) {
     case STATUS::NIL:
     case STATUS::STATE_ERROR:    throw impact_error("internal error"); break;
     case STATUS::INPUT_TOO_LONG: throw impact_error("input too long"); break;
     default: /* success */ break;
     }
-    
-    return std::string((const char*)(message_digest), HASH_SIZE);
 }
 
 
@@ -155,7 +296,7 @@ sha1::STATUS
 sha1::_S_input(
     struct context*      __context,
     const unsigned char* __message_array,
-    unsigned int         __length)
+    size_t               __length)
 {
     if (!__length) return STATUS::SUCCESS;
     else if (!__context || !__message_array || __context->corrupted)
@@ -165,24 +306,40 @@ sha1::_S_input(
         return STATUS::STATE_ERROR;
     }
     
-    while (__length-- && !__context->corrupted) {
-        __context->message_block[__context->message_block_index++] =
-                        (*__message_array & 0xFF);
-    
-        __context->length_low += 8;
-        if (__context->length_low == 0) {
-            __context->length_high++;
-            if (__context->length_high == 0) {
-                /* Message is too long */
-                __context->corrupted = true;
-            }
-        }
-    
-        if (__context->message_block_index == 64)
-            _S_process_message_block(__context);
-    
-        __message_array++;
+    std::uint64_t bits = ((std::uint64_t)__context->length_high << 32) |
+        __context->length_low;
+    if (__length > (UINT64_MAX - bits) / 8) {
+        /* Message is too long */
+        __context->corrupted = true;
+        return STATUS::INPUT_TOO_LONG;
     }
+    bits += (std::uint64_t)__length * 8;
+    __context->length_low  = (unsigned int)(bits & 0xFFFFFFFF);
+    __context->length_high = (unsigned int)(bits >> 32);
+
+    /* top up a partial block first, then hash whole blocks straight
+       from the caller's memory and keep only the remainder */
+    if (__context->message_block_index) {
+        size_t room  = 64 - __context->message_block_index;
+        size_t count = __length < room ? __length : room;
+        std::memcpy(__context->message_block +
+            __context->message_block_index, __message_array, count);
+        __context->message_block_index += count;
+        __message_array += count;
+        __length        -= count;
+        if (__context->message_block_index < 64)
+            return STATUS::SUCCESS;
+        _S_process_blocks(__context, __context->message_block, 1,
+            (int)internal::simd(), internal::sha1_ni());
+    }
+
+    _S_process_blocks(__context, __message_array, __length / 64,
+        (int)internal::simd(), internal::sha1_ni());
+    __message_array += __length / 64 * 64;
+    __length        %= 64;
+
+    std::memcpy(__context->message_block, __message_array, __length);
+    __context->message_block_index = (short int)__length;
 
     return STATUS::SUCCESS;
 }
@@ -192,11 +349,14 @@ sha1::_S_input(
  *  ProcessMessageBlock
  *
  *  Description:
- *      This function will process the next 512 bits of the message
- *      stored in the Message_Block array.
+ *      This function will process the next 512 bits of the message,
+ *      either from the Message_Block array or straight from the input.
  *
  *  Parameters:
- *      None.
+ *      context: [in/out]
+ *          The context whose intermediate hash is updated
+ *      block: [in]
+ *          64 octets of message
  *
  *  Returns:
  *      Nothing.
@@ -209,7 +369,9 @@ sha1::_S_input(
  *
  */
 void
-sha1::_S_process_message_block(struct context* __context)
+sha1::_S_process_message_block(
+    struct context*      __context,
+    const unsigned char* __block)
 {
     const unsigned int K[] = {  /* Constants defined in SHA-1  */
         0x5A827999,
@@ -226,10 +388,10 @@ sha1::_S_process_message_block(struct context* __context)
      *  Initialize the first 16 words in the array W
      */
     for (t = 0; t < 16; t++) {
-        W[t]  = __context->message_block[t * 4    ] << 24;
-        W[t] |= __context->message_block[t * 4 + 1] << 16;
-        W[t] |= __context->message_block[t * 4 + 2] << 8;
-        W[t] |= __context->message_block[t * 4 + 3];
+        W[t]  = __block[t * 4    ] << 24;
+        W[t] |= __block[t * 4 + 1] << 16;
+        W[t] |= __block[t * 4 + 2] << 8;
+        W[t] |= __block[t * 4 + 3];
     }
 
     for (t = 16; t < 80; t++) {
@@ -284,7 +446,27 @@ sha1::_S_process_message_block(struct context* __context)
     __context->intermediate_hash[2] += C;
     __context->intermediate_hash[3] += D;
     __context->intermediate_hash[4] += E;
-    __context->message_block_index = 0;
+}
+
+
+void
+sha1::_S_process_blocks(
+    struct context*       __context,
+    const unsigned char*  __data,
+    size_t                __blocks,
+    int                   __level,
+    bool                  __sha_ni) noexcept
+{
+    if (!__blocks) return;
+    auto kernel = internal::sha1_blocks_kernel(
+        (internal::simd_level)__level, __sha_ni);
+    if (kernel) {
+        kernel((std::uint32_t*)__context->intermediate_hash, __data,
+            __blocks);
+        return;
+    }
+    for (; __blocks; __blocks--, __data += 64)
+        _S_process_message_block(__context, __data);
 }
 
 
@@ -324,7 +506,9 @@ sha1::_S_pad_message(struct context* __context)
         while (__context->message_block_index < 64)
             __context->message_block[__context->message_block_index++] = 0;
 
-        _S_process_message_block(__context);
+        _S_process_blocks(__context, __context->message_block, 1,
+            (int)internal::simd(), internal::sha1_ni());
+        __context->message_block_index = 0;
 
         while (__context->message_block_index < 56)
             __context->message_block[__context->message_block_index++] = 0;
@@ -344,5 +528,7 @@ sha1::_S_pad_message(struct context* __context)
             (unsigned char)(__context->length_low  >> j);
     }
 
-    _S_process_message_block(__context);
+    _S_process_blocks(__context, __context->message_block, 1,
+        (int)internal::simd(), internal::sha1_ni());
+    __context->message_block_index = 0;
 }
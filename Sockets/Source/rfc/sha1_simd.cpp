@@ -0,0 +1,380 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/environment.h"
+
+#if defined(HAVE_X86_SIMD)
+
+#include <immintrin.h>
+
+#define TARGET_SSSE3  __attribute__((target("ssse3")))
+#define TARGET_AVX2   __attribute__((target("avx2")))
+#define TARGET_SHA    __attribute__((target("sha,sse4.1,ssse3")))
+
+/* Block kernels for rfc/sha1.cpp. Each one folds whole 64-byte blocks
+   into the five-word state, exactly as the RFC 3174 loop does.
+
+   The SSSE3 and AVX2 kernels vectorise the message schedule, four
+   words at a time, and add the round constant before the scalar
+   rounds read it back (Locktyukhin, "Improving the Performance of the
+   Secure Hash Algorithm"); AVX2 schedules two blocks at once, one per
+   128-bit lane. The SHA kernel runs the rounds on the SHA extensions. */
+
+namespace impact {
+namespace internal {
+    void sha1_blocks_ssse3(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+    void sha1_blocks_avx2(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+    void sha1_blocks_sha(std::uint32_t*, const unsigned char*, size_t)
+        noexcept;
+}}
+
+using namespace impact;
+
+namespace {
+    const std::uint32_t k_round[4] = {
+        0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+    };
+
+
+    inline std::uint32_t
+    rotl(std::uint32_t __word, unsigned int __bits)
+    {
+        return (__word << __bits) | (__word >> (32 - __bits));
+    }
+
+
+    /* W[t] + K[t] for t = 4k + i sits at wk[k * stride + i] */
+    inline void
+    rounds(
+        std::uint32_t*       __state,
+        const std::uint32_t* __wk,
+        size_t               __stride)
+    {
+        auto a = __state[0], b = __state[1], c = __state[2];
+        auto d = __state[3], e = __state[4];
+        std::uint32_t temp;
+        int t = 0;
+
+        #pragma GCC unroll 20
+        for (; t < 20; t++) {
+            temp = rotl(a, 5) + (d ^ (b & (c ^ d))) + e +
+                __wk[(t >> 2) * __stride + (t & 3)];
+            e = d; d = c; c = rotl(b, 30); b = a; a = temp;
+        }
+        #pragma GCC unroll 20
+        for (; t < 40; t++) {
+            temp = rotl(a, 5) + (b ^ c ^ d) + e +
+                __wk[(t >> 2) * __stride + (t & 3)];
+            e = d; d = c; c = rotl(b, 30); b = a; a = temp;
+        }
+        #pragma GCC unroll 20
+        for (; t < 60; t++) {
+            temp = rotl(a, 5) + ((b & c) | (d & (b | c))) + e +
+                __wk[(t >> 2) * __stride + (t & 3)];
+            e = d; d = c; c = rotl(b, 30); b = a; a = temp;
+        }
+        #pragma GCC unroll 20
+        for (; t < 80; t++) {
+            temp = rotl(a, 5) + (b ^ c ^ d) + e +
+                __wk[(t >> 2) * __stride + (t & 3)];
+            e = d; d = c; c = rotl(b, 30); b = a; a = temp;
+        }
+
+        __state[0] += a;
+        __state[1] += b;
+        __state[2] += c;
+        __state[3] += d;
+        __state[4] += e;
+    }
+
+
+    /* W[4k..4k+3] from the four vectors before it. The last lane needs
+       W[4k], computed in this same vector, so it is first built
+       without that term and then patched with rotl(W[4k], 1). */
+    TARGET_SSSE3 inline __m128i
+    expand(
+        __m128i __w1, /* W[4k-4..4k-1]   */
+        __m128i __w2, /* W[4k-8..4k-5]   */
+        __m128i __w3, /* W[4k-12..4k-9]  */
+        __m128i __w4) /* W[4k-16..4k-13] */
+    {
+        auto x = _mm_xor_si128(
+            _mm_xor_si128(_mm_srli_si128(__w1, 4), __w2),
+            _mm_xor_si128(_mm_alignr_epi8(__w3, __w4, 8), __w4));
+        x = _mm_or_si128(_mm_slli_epi32(x, 1), _mm_srli_epi32(x, 31));
+        auto fix = _mm_slli_si128(x, 12);
+        fix = _mm_or_si128(_mm_slli_epi32(fix, 1), _mm_srli_epi32(fix, 31));
+        return _mm_xor_si128(x, fix);
+    }
+
+
+    TARGET_AVX2 inline __m256i
+    expand(
+        __m256i __w1,
+        __m256i __w2,
+        __m256i __w3,
+        __m256i __w4)
+    {
+        auto x = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_srli_si256(__w1, 4), __w2),
+            _mm256_xor_si256(_mm256_alignr_epi8(__w3, __w4, 8), __w4));
+        x = _mm256_or_si256(_mm256_slli_epi32(x, 1),
+            _mm256_srli_epi32(x, 31));
+        auto fix = _mm256_slli_si256(x, 12);
+        fix = _mm256_or_si256(_mm256_slli_epi32(fix, 1),
+            _mm256_srli_epi32(fix, 31));
+        return _mm256_xor_si256(x, fix);
+    }
+}
+
+
+TARGET_SSSE3 void
+internal::sha1_blocks_ssse3(
+    std::uint32_t*       __state,
+    const unsigned char* __data,
+    size_t               __blocks) noexcept
+{
+    const auto swap = _mm_set_epi8(
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    alignas(16) std::uint32_t wk[80];
+    __m128i w[20];
+
+    for (; __blocks; __blocks--, __data += 64) {
+        for (int k = 0; k < 20; k++) {
+            if (k < 4) w[k] = _mm_shuffle_epi8(_mm_loadu_si128(
+                (const __m128i*)(__data + 16 * k)), swap);
+            else w[k] = expand(w[k - 1], w[k - 2], w[k - 3], w[k - 4]);
+            _mm_store_si128((__m128i*)(wk + 4 * k), _mm_add_epi32(w[k],
+                _mm_set1_epi32((int)k_round[k / 5])));
+        }
+        rounds(__state, wk, 4);
+    }
+}
+
+
+TARGET_AVX2 void
+internal::sha1_blocks_avx2(
+    std::uint32_t*       __state,
+    const unsigned char* __data,
+    size_t               __blocks) noexcept
+{
+    const auto swap = _mm256_set_epi8(
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    /* two blocks interleaved four words at a time */
+    alignas(32) std::uint32_t wk[160];
+    __m256i w[20];
+
+    for (; __blocks >= 2; __blocks -= 2, __data += 128) {
+        for (int k = 0; k < 20; k++) {
+            if (k < 4) w[k] = _mm256_shuffle_epi8(_mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(
+                    (const __m128i*)(__data + 16 * k))),
+                _mm_loadu_si128((const __m128i*)(__data + 64 + 16 * k)), 1),
+                swap);
+            else w[k] = expand(w[k - 1], w[k - 2], w[k - 3], w[k - 4]);
+            _mm256_store_si256((__m256i*)(wk + 8 * k), _mm256_add_epi32(w[k],
+                _mm256_set1_epi32((int)k_round[k / 5])));
+        }
+        rounds(__state, wk, 8);
+        rounds(__state, wk + 4, 8);
+    }
+
+    if (__blocks) sha1_blocks_ssse3(__state, __data, __blocks);
+}
+
+
+/* Twenty groups of four rounds. Each group consumes one message
+   vector while sha1msg1, xor and sha1msg2 finish the vector three
+   groups ahead; E alternates between two registers, sha1nexte
+   deriving the next E from the current A. */
+TARGET_SHA void
+internal::sha1_blocks_sha(
+    std::uint32_t*       __state,
+    const unsigned char* __data,
+    size_t               __blocks) noexcept
+{
+    const auto swap = _mm_set_epi64x(
+        0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+    __m128i abcd, abcd_save, e0, e0_save, e1;
+    __m128i msg0, msg1, msg2, msg3;
+
+    abcd = _mm_shuffle_epi32(
+        _mm_loadu_si128((const __m128i*)__state), 0x1B);
+    e0   = _mm_set_epi32((int)__state[4], 0, 0, 0);
+
+    for (; __blocks; __blocks--, __data += 64) {
+        abcd_save = abcd;
+        e0_save   = e0;
+
+        /* rounds 0-3 */
+        msg0 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(__data + 0)), swap);
+        e0   = _mm_add_epi32(e0, msg0);
+        e1   = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        /* rounds 4-7 */
+        msg1 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(__data + 16)), swap);
+        e1   = _mm_sha1nexte_epu32(e1, msg1);
+        e0   = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+        /* rounds 8-11 */
+        msg2 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(__data + 32)), swap);
+        e0   = _mm_sha1nexte_epu32(e0, msg2);
+        e1   = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* rounds 12-15 */
+        msg3 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(__data + 48)), swap);
+        e1   = _mm_sha1nexte_epu32(e1, msg3);
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* rounds 16-19 */
+        e0   = _mm_sha1nexte_epu32(e0, msg0);
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* rounds 20-23 */
+        e1   = _mm_sha1nexte_epu32(e1, msg1);
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* rounds 24-27 */
+        e0   = _mm_sha1nexte_epu32(e0, msg2);
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* rounds 28-31 */
+        e1   = _mm_sha1nexte_epu32(e1, msg3);
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* rounds 32-35 */
+        e0   = _mm_sha1nexte_epu32(e0, msg0);
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* rounds 36-39 */
+        e1   = _mm_sha1nexte_epu32(e1, msg1);
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* rounds 40-43 */
+        e0   = _mm_sha1nexte_epu32(e0, msg2);
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* rounds 44-47 */
+        e1   = _mm_sha1nexte_epu32(e1, msg3);
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* rounds 48-51 */
+        e0   = _mm_sha1nexte_epu32(e0, msg0);
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* rounds 52-55 */
+        e1   = _mm_sha1nexte_epu32(e1, msg1);
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* rounds 56-59 */
+        e0   = _mm_sha1nexte_epu32(e0, msg2);
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* rounds 60-63 */
+        e1   = _mm_sha1nexte_epu32(e1, msg3);
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* rounds 64-67 */
+        e0   = _mm_sha1nexte_epu32(e0, msg0);
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* rounds 68-71 */
+        e1   = _mm_sha1nexte_epu32(e1, msg1);
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* rounds 72-75 */
+        e0   = _mm_sha1nexte_epu32(e0, msg2);
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+        /* rounds 76-79 */
+        e1   = _mm_sha1nexte_epu32(e1, msg3);
+        e0   = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+        e0   = _mm_sha1nexte_epu32(e0, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128((__m128i*)__state, _mm_shuffle_epi32(abcd, 0x1B));
+    __state[4] = (std::uint32_t)_mm_extract_epi32(e0, 3);
+}
+
+#endif /* HAVE_X86_SIMD */
@@ -401,7 +401,7 @@ uri::_S_percent_decode(
     std::istringstream is(*__str);
     std::ostringstream os;
     int state = 0;
-    char nibble[2], c;
+    char nibble[2] = { 0, 0 }, c;
     
     while (is >> c) {
         if (state == 0) {
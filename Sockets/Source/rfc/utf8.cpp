@@ -5,37 +5,279 @@
 #include "rfc/utf8.h"
 
 #include <sstream>
+#include <cstring>
+#include <algorithm>
 
 #include "utils/errno.h"
+#include "utils/cpu_features.h"
 
 
 using namespace impact;
 
+namespace impact {
+namespace internal {
+    imperr utf8_check(const unsigned char* data, size_t length,
+        size_t* symbols) noexcept;
+    inline bool utf8_ascii8(const unsigned char* data) noexcept;
+
+    /* block kernels for one simd_level; all NULL for SCALAR */
+    struct utf8_kernels {
+        size_t block;
+        bool   (*validate)(const unsigned char*, size_t, size_t*);
+        size_t (*widen16)(const unsigned char*, size_t, char16_t*);
+        size_t (*widen32)(const unsigned char*, size_t, char32_t*);
+        size_t (*narrow16)(const char16_t*, size_t, unsigned char*);
+        size_t (*narrow32)(const char32_t*, size_t, unsigned char*);
+    };
+    const utf8_kernels& utf8_kernels_at(simd_level level) noexcept;
+
+#if defined(HAVE_X86_SIMD)
+    /* rfc/utf8_simd.cpp */
+    bool utf8_validate_ssse3(const unsigned char*, size_t, size_t*)
+        noexcept;
+    bool utf8_validate_avx2(const unsigned char*, size_t, size_t*)
+        noexcept;
+    size_t utf8_widen16_ssse3(const unsigned char*, size_t, char16_t*)
+        noexcept;
+    size_t utf8_widen32_ssse3(const unsigned char*, size_t, char32_t*)
+        noexcept;
+    size_t utf8_narrow16_ssse3(const char16_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_narrow32_ssse3(const char32_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_widen16_avx2(const unsigned char*, size_t, char16_t*)
+        noexcept;
+    size_t utf8_widen32_avx2(const unsigned char*, size_t, char32_t*)
+        noexcept;
+    size_t utf8_narrow16_avx2(const char16_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_narrow32_avx2(const char32_t*, size_t, unsigned char*)
+        noexcept;
+#endif
+}}
+
+namespace {
+    /* Next code point of UTF-16 or UTF-32 text. False on an unpaired
+       surrogate or anything past U+10FFFF. */
+    inline bool
+    next_symbol(
+        const char16_t* __data,
+        size_t          __length,
+        size_t&         __index,
+        char32_t&       __symbol) noexcept
+    {
+        char32_t unit = __data[__index++];
+        if (unit < 0xD800 || unit > 0xDFFF) {
+            __symbol = unit;
+            return true;
+        }
+        if (unit > 0xDBFF || __index == __length) return false;
+        char32_t low = __data[__index];
+        if (low < 0xDC00 || low > 0xDFFF) return false;
+        __index++;
+        __symbol = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+        return true;
+    }
+
+
+    inline bool
+    next_symbol(
+        const char32_t* __data,
+        size_t          /* __length */,
+        size_t&         __index,
+        char32_t&       __symbol) noexcept
+    {
+        __symbol = __data[__index++];
+        return __symbol <= 0x10FFFF &&
+            (__symbol < 0xD800 || __symbol > 0xDFFF);
+    }
+
+
+    inline void
+    put_symbol(
+        char32_t   __symbol,
+        char32_t*& __result) noexcept
+    {
+        *__result++ = __symbol;
+    }
+
+
+    inline void
+    put_symbol(
+        char32_t   __symbol,
+        char16_t*& __result) noexcept
+    {
+        if (__symbol < 0x10000) {
+            *__result++ = (char16_t)__symbol;
+            return;
+        }
+        __symbol -= 0x10000;
+        *__result++ = (char16_t)(0xD800 | (__symbol >> 10));
+        *__result++ = (char16_t)(0xDC00 | (__symbol & 0x3FF));
+    }
+
+
+    /* same layout as utf8::_S_encode, into a raw buffer */
+    inline size_t
+    encode_symbol(
+        char32_t       __symbol,
+        unsigned char* __result) noexcept
+    {
+        if (__symbol <= 0x00007F) {
+            __result[0] = (unsigned char)__symbol;
+            return 1;
+        }
+        if (__symbol <= 0x0007FF) {
+            __result[0] = (unsigned char)(0xC0 | (__symbol >> 6));
+            __result[1] = (unsigned char)(0x80 | (__symbol & 0x3F));
+            return 2;
+        }
+        if (__symbol <= 0x00FFFF) {
+            __result[0] = (unsigned char)(0xE0 | (__symbol >> 12));
+            __result[1] = (unsigned char)(0x80 | ((__symbol >> 6) & 0x3F));
+            __result[2] = (unsigned char)(0x80 | (__symbol & 0x3F));
+            return 3;
+        }
+        __result[0] = (unsigned char)(0xF0 | (__symbol >> 18));
+        __result[1] = (unsigned char)(0x80 | ((__symbol >> 12) & 0x3F));
+        __result[2] = (unsigned char)(0x80 | ((__symbol >> 6) & 0x3F));
+        __result[3] = (unsigned char)(0x80 | (__symbol & 0x3F));
+        return 4;
+    }
+
+
+    template <typename T>
+    bool
+    encoded_size(
+        const T* __data,
+        size_t   __length,
+        size_t*  __size) noexcept
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < __length;) {
+            char32_t symbol;
+            if (!next_symbol(__data, __length, i, symbol)) return false;
+            size += symbol < 0x80 ? 1 : (symbol < 0x800 ? 2 :
+                (symbol < 0x10000 ? 3 : 4));
+        }
+        *__size = size;
+        return true;
+    }
+
+
+    template <typename T>
+    bool
+    encode_units(
+        const T*       __data,
+        size_t         __length,
+        unsigned char* __result,
+        size_t*        __written,
+        size_t       (*__kernel)(const T*, size_t, unsigned char*),
+        size_t         __block) noexcept
+    {
+        size_t i = 0, o = 0;
+        while (i < __length) {
+            if (__kernel && __length - i >= __block) {
+                auto count = __kernel(__data + i, __length - i, __result + o);
+                i += count;
+                o += count;
+            }
+            /* a block's worth by hand before asking the kernel again */
+            auto stop = __kernel ? std::min(__length, i + __block) : __length;
+            while (i < stop) {
+                if (__data[i] < 0x80) {
+                    __result[o++] = (unsigned char)__data[i++];
+                    continue;
+                }
+                char32_t symbol;
+                if (!next_symbol(__data, __length, i, symbol)) {
+                    *__written = o;
+                    return false;
+                }
+                o += encode_symbol(symbol, __result + o);
+            }
+        }
+        *__written = o;
+        return true;
+    }
+
+
+    template <typename T>
+    size_t
+    decode_units(
+        const unsigned char* __data,
+        size_t               __length,
+        T*                   __result,
+        size_t             (*__kernel)(const unsigned char*, size_t, T*),
+        size_t               __block) noexcept
+    {
+        auto output = __result;
+        size_t i = 0;
+        while (i < __length) {
+            if (__kernel && __length - i >= __block) {
+                auto count = __kernel(__data + i, __length - i, output);
+                i      += count;
+                output += count;
+            }
+            auto stop = __kernel ? std::min(__length, i + __block) : __length;
+            while (i < stop) {
+                if (i + 8 <= __length && internal::utf8_ascii8(__data + i)) {
+                    for (unsigned int j = 0; j < 8; j++)
+                        output[j] = __data[i + j];
+                    output += 8;
+                    i      += 8;
+                    continue;
+                }
+                char32_t c = __data[i];
+                if (c < 0x80) {
+                    *output++ = (T)c;
+                    i += 1;
+                }
+                else if (c < 0xE0) {
+                    put_symbol(((c & 0x1F) << 6) | (__data[i + 1] & 0x3F),
+                        output);
+                    i += 2;
+                }
+                else if (c < 0xF0) {
+                    put_symbol(((c & 0x0F) << 12) |
+                        ((char32_t)(__data[i + 1] & 0x3F) << 6) |
+                        (__data[i + 2] & 0x3F), output);
+                    i += 3;
+                }
+                else {
+                    put_symbol(((c & 0x07) << 18) |
+                        ((char32_t)(__data[i + 1] & 0x3F) << 12) |
+                        ((char32_t)(__data[i + 2] & 0x3F) << 6) |
+                        (__data[i + 3] & 0x3F), output);
+                    i += 4;
+                }
+            }
+        }
+        return (size_t)(output - __result);
+    }
+}
+
 /*  NOTE:
-    The serialize string functions use the same
-    code snippet below but each use a different
-    basic_string<T> type.
+    The UTF-16 and UTF-32 serialize string functions
+    use the same code snippet below but each use a
+    different basic_string<T> type.
 */
 
-#define SERIALIZE_STRING_CODE_SNIPPET(mask) {           \
+#define SERIALIZE_STRING_CODE_SNIPPET {                 \
     imp_errno = imperr::SUCCESS;                        \
-    size_t size = 0;                                    \
-    for (auto& c : __input) {                           \
-        size_t test = _S_estimate_buf_size( mask & c ); \
-        if (test == static_cast<size_t>(-1)) {          \
-            size = test;                                \
-            break;                                      \
-        }                                               \
-        size += test;                                   \
-    }                                                   \
-    if (size == static_cast<size_t>(-1)) {              \
+    size_t size;                                        \
+    if (!encoded_size(__input.data(), __input.size(),   \
+            &size)) {                                   \
         imp_errno = imperr::UTF8_BADSYM;                \
         return false;                                   \
     }                                                   \
-    if (__result) {                                     \
-        __result->reserve(size + __result->size());     \
-        for (auto& symbol : __input)                    \
-            _S_encode( mask & symbol, __result);        \
+    if (__result && size) {                             \
+        auto offset = __result->size();                 \
+        __result->resize(offset + size);                \
+        size_t written;                                 \
+        _S_serialize(__input.data(), __input.size(),    \
+            (unsigned char*)&(*__result)[offset],       \
+            &written, (int)internal::simd());           \
     }                                                   \
     return true;                                        \
 }
@@ -65,7 +307,17 @@ utf8::serialize(
     const std::string& __input,
     std::string*       __result)
 {
-    SERIALIZE_STRING_CODE_SNIPPET(0x000000FF)
+    /* every byte is a code point below U+0100, so nothing can fail */
+    imp_errno = imperr::SUCCESS;
+    if (__result) {
+        size_t size = __input.size();
+        for (auto c : __input)
+            if (c & 0x80) size++;
+        __result->reserve(size + __result->size());
+        for (auto c : __input)
+            _S_encode(0xFF & c, __result);
+    }
+    return true;
 }
 
 
@@ -74,7 +326,7 @@ utf8::serialize(
     const std::u16string& __input,
     std::string*          __result)
 {
-    SERIALIZE_STRING_CODE_SNIPPET(0x0000FFFF)
+    SERIALIZE_STRING_CODE_SNIPPET
 }
 
 
@@ -83,7 +335,33 @@ utf8::serialize(
     const std::u32string& __input,
     std::string*          __result)
 {
-    SERIALIZE_STRING_CODE_SNIPPET(0xFFFFFFFF)
+    SERIALIZE_STRING_CODE_SNIPPET
+}
+
+
+bool
+utf8::serialize(
+    const char16_t* __data,
+    size_t          __length,
+    char*           __result,
+    size_t*         __written) noexcept
+{
+    imp_errno = imperr::SUCCESS;
+    return _S_serialize(__data, __length, (unsigned char*)__result,
+        __written, (int)internal::simd());
+}
+
+
+bool
+utf8::serialize(
+    const char32_t* __data,
+    size_t          __length,
+    char*           __result,
+    size_t*         __written) noexcept
+{
+    imp_errno = imperr::SUCCESS;
+    return _S_serialize(__data, __length, (unsigned char*)__result,
+        __written, (int)internal::simd());
 }
 
 
@@ -91,44 +369,304 @@ bool
 utf8::deserialize(
     const std::string& __input,
     std::u32string*    __result)
+{
+    auto input  = (const unsigned char*)__input.data();
+    auto length = __input.size();
+    size_t symbols;
+    if (!_S_validate(input, length, (int)internal::simd(), &symbols))
+        return false;
+    if (!__result || !symbols) return true;
+
+    /* one code point per unit, so the count is exact */
+    auto offset = __result->size();
+    __result->resize(offset + symbols);
+    _S_deserialize(input, length, &(*__result)[offset],
+        (int)internal::simd());
+    return true;
+}
+
+
+bool
+utf8::deserialize_utf16(
+    const std::string& __input,
+    std::u16string*    __result)
+{
+    auto input  = (const unsigned char*)__input.data();
+    auto length = __input.size();
+    size_t symbols;
+    if (!_S_validate(input, length, (int)internal::simd(), &symbols))
+        return false;
+    if (!__result || !symbols) return true;
+
+    /* pairs take two units, but never more than the bytes they came
+       from */
+    auto offset = __result->size();
+    __result->resize(offset + length);
+    __result->resize(offset + _S_deserialize(input, length,
+        &(*__result)[offset], (int)internal::simd()));
+    return true;
+}
+
+
+bool
+utf8::deserialize(
+    const char* __data,
+    size_t      __length,
+    char16_t*   __result,
+    size_t*     __written) noexcept
+{
+    auto input = (const unsigned char*)__data;
+    size_t symbols;
+    if (!_S_validate(input, __length, (int)internal::simd(), &symbols)) {
+        *__written = 0;
+        return false;
+    }
+    *__written = _S_deserialize(input, __length, __result,
+        (int)internal::simd());
+    return true;
+}
+
+
+bool
+utf8::deserialize(
+    const char* __data,
+    size_t      __length,
+    char32_t*   __result,
+    size_t*     __written) noexcept
+{
+    auto input = (const unsigned char*)__data;
+    size_t symbols;
+    if (!_S_validate(input, __length, (int)internal::simd(), &symbols)) {
+        *__written = 0;
+        return false;
+    }
+    *__written = _S_deserialize(input, __length, __result,
+        (int)internal::simd());
+    return true;
+}
+
+
+bool
+utf8::validate(const std::string& __input)
+{
+    return validate(__input.data(), __input.size());
+}
+
+
+bool
+utf8::validate(
+    const char* __data,
+    size_t      __length)
+{
+    size_t symbols;
+    return _S_validate((const unsigned char*)__data, __length,
+        (int)internal::simd(), &symbols);
+}
+
+
+bool
+utf8::_S_validate(
+    const unsigned char* __data,
+    size_t               __length,
+    int                  __level,
+    size_t*              __symbols) noexcept
 {
     imp_errno = imperr::SUCCESS;
 
-    int state = 0;
-    uint32_t symbol;
-    for (char c : __input) {
-        switch (state) {
-        case 0: /* header */ {
-            if ((c & 0x80) == 0x00) {
-                symbol = c;
-                if (__result) __result->push_back(symbol);
-                continue;
-            }
-                 if ((c & 0xE0) == 0xC0) state = 1;
-            else if ((c & 0xF0) == 0xE0) state = 2;
-            else if ((c & 0xF8) == 0xF0) state = 3;
-            else goto header_error;
-            symbol = ((0x3F >> state) & c);
-            continue;
-        header_error:
-            imp_errno = imperr::UTF8_BADHEAD;
-            return false;
-        } break;
-        default: /* trailer */ {
-            if ((c & 0xC0) == 0x80) {
-                symbol <<= 6;
-                symbol |= (0x3F & c);
-                state--;
-                if (state == 0 && __result)
-                    __result->push_back(symbol);
+    const auto& kernels = internal::utf8_kernels_at(
+        (internal::simd_level)__level);
+    auto block  = kernels.block;
+    auto kernel = kernels.validate;
+
+    if (kernel && __length >= block) {
+        size_t blocks = __length / block * block;
+        size_t simd_symbols, tail_symbols;
+        if (kernel(__data, blocks, &simd_symbols)) {
+            /* restart the tail at a lead byte the blocks cut short */
+            size_t tail = blocks;
+            for (size_t k = 1; k <= 3; k++) {
+                unsigned char c = __data[blocks - k];
+                if (c < 0x80) break;
+                if (c < 0xC0) continue;
+                size_t size = c >= 0xF0 ? 4 : (c >= 0xE0 ? 3 : 2);
+                if (size > k) tail = blocks - k;
+                break;
             }
-            else {
-                imp_errno = imperr::UTF8_BADTRAIL;
-                return false;
+            if (internal::utf8_check(__data + tail, __length - tail,
+                &tail_symbols) == imperr::SUCCESS) {
+                *__symbols = simd_symbols + tail_symbols -
+                    (tail < blocks ? 1 : 0);
+                return true;
             }
-        } break;
         }
+        /* let the scalar pass name the error */
     }
 
-    return true;
+    auto status = internal::utf8_check(__data, __length, __symbols);
+    if (status == imperr::SUCCESS) return true;
+    imp_errno = status;
+    return false;
+}
+
+
+bool
+utf8::_S_serialize(
+    const char16_t*      __data,
+    size_t               __length,
+    unsigned char*       __result,
+    size_t*              __written,
+    int                  __level) noexcept
+{
+    const auto& kernels = internal::utf8_kernels_at(
+        (internal::simd_level)__level);
+    if (encode_units(__data, __length, __result, __written,
+            kernels.narrow16, kernels.block))
+        return true;
+    imp_errno = imperr::UTF8_BADSYM;
+    return false;
+}
+
+
+bool
+utf8::_S_serialize(
+    const char32_t*      __data,
+    size_t               __length,
+    unsigned char*       __result,
+    size_t*              __written,
+    int                  __level) noexcept
+{
+    const auto& kernels = internal::utf8_kernels_at(
+        (internal::simd_level)__level);
+    if (encode_units(__data, __length, __result, __written,
+            kernels.narrow32, kernels.block))
+        return true;
+    imp_errno = imperr::UTF8_BADSYM;
+    return false;
+}
+
+
+size_t
+utf8::_S_deserialize(
+    const unsigned char* __data,
+    size_t               __length,
+    char16_t*            __result,
+    int                  __level) noexcept
+{
+    const auto& kernels = internal::utf8_kernels_at(
+        (internal::simd_level)__level);
+    return decode_units(__data, __length, __result, kernels.widen16,
+        kernels.block);
+}
+
+
+size_t
+utf8::_S_deserialize(
+    const unsigned char* __data,
+    size_t               __length,
+    char32_t*            __result,
+    int                  __level) noexcept
+{
+    const auto& kernels = internal::utf8_kernels_at(
+        (internal::simd_level)__level);
+    return decode_units(__data, __length, __result, kernels.widen32,
+        kernels.block);
+}
+
+
+const internal::utf8_kernels&
+internal::utf8_kernels_at(simd_level __level) noexcept
+{
+    static const utf8_kernels k_scalar = {
+        0, NULL, NULL, NULL, NULL, NULL
+    };
+#if defined(HAVE_X86_SIMD)
+    static const utf8_kernels k_ssse3 = {
+        16, utf8_validate_ssse3, utf8_widen16_ssse3, utf8_widen32_ssse3,
+        utf8_narrow16_ssse3, utf8_narrow32_ssse3
+    };
+    /* no AVX-512 tier; 64-byte blocks rarely stay all ASCII */
+    static const utf8_kernels k_avx2 = {
+        32, utf8_validate_avx2, utf8_widen16_avx2, utf8_widen32_avx2,
+        utf8_narrow16_avx2, utf8_narrow32_avx2
+    };
+    switch (__level) {
+    case simd_level::SSSE3:  return k_ssse3;
+    case simd_level::AVX2:
+    case simd_level::AVX512: return k_avx2;
+    default: break;
+    }
+#else
+    (void)__level;
+#endif
+    return k_scalar;
+}
+
+
+inline bool
+internal::utf8_ascii8(const unsigned char* __data) noexcept
+{
+    std::uint64_t word;
+    std::memcpy(&word, __data, sizeof(word));
+    return (word & 0x8080808080808080ULL) == 0;
+}
+
+
+imperr
+internal::utf8_check(
+    const unsigned char* __data,
+    size_t               __length,
+    size_t*              __symbols) noexcept
+{
+    /*
+        RFC3629 Section 4. Syntax of UTF-8 Byte Sequences
+        UTF8-2  = %xC2-DF UTF8-tail
+        UTF8-3  = %xE0 %xA0-BF UTF8-tail / %xE1-EC 2( UTF8-tail ) /
+                  %xED %x80-9F UTF8-tail / %xEE-EF 2( UTF8-tail )
+        UTF8-4  = %xF0 %x90-BF 2( UTF8-tail ) / %xF1-F3 3( UTF8-tail ) /
+                  %xF4 %x80-8F 2( UTF8-tail )
+    */
+    size_t symbols = 0;
+    size_t i = 0;
+    while (i < __length) {
+        if (i + 8 <= __length && utf8_ascii8(__data + i)) {
+            symbols += 8;
+            i       += 8;
+            continue;
+        }
+        unsigned char c = __data[i];
+        symbols++;
+        if (c < 0x80) {
+            i++;
+            continue;
+        }
+
+        size_t trail;
+        unsigned char low = 0x80, high = 0xBF;
+        if (c < 0xC0) return imperr::UTF8_BADHEAD;
+        else if (c < 0xC2) return imperr::UTF8_BADSYM;
+        else if (c < 0xE0) trail = 1;
+        else if (c < 0xF0) {
+            trail = 2;
+            if (c == 0xE0) low  = 0xA0; /* overlong */
+            if (c == 0xED) high = 0x9F; /* surrogate */
+        }
+        else if (c < 0xF5) {
+            trail = 3;
+            if (c == 0xF0) low  = 0x90; /* overlong */
+            if (c == 0xF4) high = 0x8F; /* above U+10FFFF */
+        }
+        else if (c < 0xF8) return imperr::UTF8_BADSYM;
+        else return imperr::UTF8_BADHEAD;
+
+        for (size_t k = 1; k <= trail; k++) {
+            if (i + k >= __length) return imperr::UTF8_BADTRAIL;
+            unsigned char t = __data[i + k];
+            if ((t & 0xC0) != 0x80) return imperr::UTF8_BADTRAIL;
+            if (k == 1 && (t < low || t > high)) return imperr::UTF8_BADSYM;
+        }
+        i += trail + 1;
+    }
+
+    *__symbols = symbols;
+    return imperr::SUCCESS;
 }
@@ -0,0 +1,469 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/environment.h"
+
+#if defined(HAVE_X86_SIMD)
+
+#include <immintrin.h>
+
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX2  __attribute__((target("avx2")))
+
+/* Block validators for rfc/utf8.cpp, after Keiser and Lemire,
+   "Validating UTF-8 In Less Than One Instruction Per Byte" (the
+   simdjson lookup algorithm). Three nibble lookups classify every byte
+   pair; a separate test catches third and fourth bytes that are not
+   continuations. Blocks of plain ASCII only check that the previous
+   block did not stop mid-sequence.
+
+   Each one takes a whole number of blocks and also counts the bytes
+   that start a code point. A sequence cut off at the end is not an
+   error here: the scalar code rechecks from its lead byte.
+
+   The widen and narrow kernels copy ASCII between UTF-8 and UTF-16 or
+   UTF-32 one block at a time, and stop at the first block holding
+   anything else. They return how many units they copied. */
+
+namespace impact {
+namespace internal {
+    bool utf8_validate_ssse3(const unsigned char*, size_t, size_t*)
+        noexcept;
+    bool utf8_validate_avx2(const unsigned char*, size_t, size_t*)
+        noexcept;
+
+    size_t utf8_widen16_ssse3(const unsigned char*, size_t, char16_t*)
+        noexcept;
+    size_t utf8_widen32_ssse3(const unsigned char*, size_t, char32_t*)
+        noexcept;
+    size_t utf8_narrow16_ssse3(const char16_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_narrow32_ssse3(const char32_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_widen16_avx2(const unsigned char*, size_t, char16_t*)
+        noexcept;
+    size_t utf8_widen32_avx2(const unsigned char*, size_t, char32_t*)
+        noexcept;
+    size_t utf8_narrow16_avx2(const char16_t*, size_t, unsigned char*)
+        noexcept;
+    size_t utf8_narrow32_avx2(const char32_t*, size_t, unsigned char*)
+        noexcept;
+}}
+
+using namespace impact;
+
+namespace {
+    /* one bit per error class; a pair is invalid when the classes of
+       its first byte's high and low nibble and its second byte's high
+       nibble share a bit */
+    const unsigned char k_too_short  = 1 << 0; /* lead, no continuation */
+    const unsigned char k_too_long   = 1 << 1; /* ASCII, continuation   */
+    const unsigned char k_overlong_3 = 1 << 2; /* E0 80..9F             */
+    const unsigned char k_too_large  = 1 << 3; /* F4 90.., F5..         */
+    const unsigned char k_surrogate  = 1 << 4; /* ED A0..BF             */
+    const unsigned char k_overlong_2 = 1 << 5; /* C0, C1                */
+    const unsigned char k_too_large_1000 = 1 << 6;
+    const unsigned char k_overlong_4 = 1 << 6; /* F0 80..8F             */
+    const unsigned char k_two_conts  = 1 << 7; /* continuation, cont.   */
+    const unsigned char k_carry = k_too_short | k_too_long | k_two_conts;
+
+    const unsigned char k_byte_1_high[16] = {
+        /* 0_______ */
+        k_too_long, k_too_long, k_too_long, k_too_long,
+        k_too_long, k_too_long, k_too_long, k_too_long,
+        /* 10______ */
+        k_two_conts, k_two_conts, k_two_conts, k_two_conts,
+        /* 1100____ */
+        k_too_short | k_overlong_2,
+        /* 1101____ */
+        k_too_short,
+        /* 1110____ */
+        k_too_short | k_overlong_3 | k_surrogate,
+        /* 1111____ */
+        k_too_short | k_too_large | k_too_large_1000 | k_overlong_4
+    };
+    const unsigned char k_byte_1_low[16] = {
+        /* ____0000 */
+        k_carry | k_overlong_3 | k_overlong_2 | k_overlong_4,
+        /* ____0001 */
+        k_carry | k_overlong_2,
+        /* ____001_ */
+        k_carry,
+        k_carry,
+        /* ____0100 */
+        k_carry | k_too_large,
+        /* ____0101 and up */
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000,
+        /* ____1101 */
+        k_carry | k_too_large | k_too_large_1000 | k_surrogate,
+        k_carry | k_too_large | k_too_large_1000,
+        k_carry | k_too_large | k_too_large_1000
+    };
+    const unsigned char k_byte_2_high[16] = {
+        /* 0_______ */
+        k_too_short, k_too_short, k_too_short, k_too_short,
+        k_too_short, k_too_short, k_too_short, k_too_short,
+        /* 1000____ */
+        k_too_long | k_overlong_2 | k_two_conts | k_overlong_3 |
+            k_too_large_1000 | k_overlong_4,
+        /* 1001____ */
+        k_too_long | k_overlong_2 | k_two_conts | k_overlong_3 |
+            k_too_large,
+        /* 101_____ */
+        k_too_long | k_overlong_2 | k_two_conts | k_surrogate | k_too_large,
+        k_too_long | k_overlong_2 | k_two_conts | k_surrogate | k_too_large,
+        /* 11______ */
+        k_too_short, k_too_short, k_too_short, k_too_short
+    };
+    /* a lead byte this close to the end of a block needs the next one */
+    const unsigned char k_incomplete[32] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+    };
+
+
+    TARGET_SSSE3 inline __m128i
+    check_block(
+        __m128i __input,
+        __m128i __previous)
+    {
+        const auto nibble = _mm_set1_epi8(0x0F);
+        auto prev1 = _mm_alignr_epi8(__input, __previous, 15);
+        auto prev2 = _mm_alignr_epi8(__input, __previous, 14);
+        auto prev3 = _mm_alignr_epi8(__input, __previous, 13);
+
+        auto classes = _mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i*)k_byte_1_high),
+                    _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i*)k_byte_1_low),
+                    _mm_and_si128(prev1, nibble))),
+            _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i*)k_byte_2_high),
+                _mm_and_si128(_mm_srli_epi16(__input, 4), nibble)));
+
+        /* third and fourth bytes must be continuations; those are the
+           only ones the pair test left at 0x80 */
+        auto must_continue = _mm_and_si128(_mm_or_si128(
+            _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80))),
+            _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)))),
+            _mm_set1_epi8((char)0x80));
+        return _mm_xor_si128(must_continue, classes);
+    }
+
+
+    TARGET_AVX2 inline __m256i
+    table(const unsigned char* __entries)
+    {
+        return _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)__entries));
+    }
+
+
+    TARGET_AVX2 inline __m256i
+    check_block(
+        __m256i __input,
+        __m256i __previous)
+    {
+        const auto nibble = _mm256_set1_epi8(0x0F);
+        /* the previous bytes cross the 128-bit lanes */
+        auto shifted = _mm256_permute2x128_si256(__previous, __input, 0x21);
+        auto prev1 = _mm256_alignr_epi8(__input, shifted, 15);
+        auto prev2 = _mm256_alignr_epi8(__input, shifted, 14);
+        auto prev3 = _mm256_alignr_epi8(__input, shifted, 13);
+
+        auto classes = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(table(k_byte_1_high),
+                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                _mm256_shuffle_epi8(table(k_byte_1_low),
+                    _mm256_and_si256(prev1, nibble))),
+            _mm256_shuffle_epi8(table(k_byte_2_high),
+                _mm256_and_si256(_mm256_srli_epi16(__input, 4), nibble)));
+
+        auto must_continue = _mm256_and_si256(_mm256_or_si256(
+            _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80))),
+            _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)))),
+            _mm256_set1_epi8((char)0x80));
+        return _mm256_xor_si256(must_continue, classes);
+    }
+}
+
+
+TARGET_SSSE3 bool
+internal::utf8_validate_ssse3(
+    const unsigned char* __data,
+    size_t               __length,
+    size_t*              __symbols) noexcept
+{
+    const auto incomplete =
+        _mm_loadu_si128((const __m128i*)(k_incomplete + 16));
+    auto error      = _mm_setzero_si128();
+    auto previous   = _mm_setzero_si128();
+    auto unfinished = _mm_setzero_si128();
+    auto leads      = _mm_setzero_si128();
+    size_t ascii = 0;
+
+    for (size_t i = 0; i + 16 <= __length; i += 16) {
+        auto input = _mm_loadu_si128((const __m128i*)(__data + i));
+        if (_mm_movemask_epi8(input) == 0) {
+            error = _mm_or_si128(error, unfinished);
+            unfinished = _mm_setzero_si128();
+            ascii += 16;
+        }
+        else {
+            error = _mm_or_si128(error, check_block(input, previous));
+            unfinished = _mm_subs_epu8(input, incomplete);
+            /* every byte outside 80..BF starts a code point */
+            leads = _mm_add_epi64(leads, _mm_sad_epu8(_mm_and_si128(
+                _mm_cmpgt_epi8(input, _mm_set1_epi8(-65)),
+                _mm_set1_epi8(1)), _mm_setzero_si128()));
+        }
+        previous = input;
+    }
+
+    alignas(16) std::uint64_t sums[2];
+    _mm_store_si128((__m128i*)sums, leads);
+    *__symbols = ascii + (size_t)(sums[0] + sums[1]);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128()))
+        == 0xFFFF;
+}
+
+
+TARGET_AVX2 bool
+internal::utf8_validate_avx2(
+    const unsigned char* __data,
+    size_t               __length,
+    size_t*              __symbols) noexcept
+{
+    const auto incomplete =
+        _mm256_loadu_si256((const __m256i*)k_incomplete);
+    auto error      = _mm256_setzero_si256();
+    auto previous   = _mm256_setzero_si256();
+    auto unfinished = _mm256_setzero_si256();
+    auto leads      = _mm256_setzero_si256();
+    size_t ascii = 0;
+
+    for (size_t i = 0; i + 32 <= __length; i += 32) {
+        auto input = _mm256_loadu_si256((const __m256i*)(__data + i));
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, unfinished);
+            unfinished = _mm256_setzero_si256();
+            ascii += 32;
+        }
+        else {
+            error = _mm256_or_si256(error, check_block(input, previous));
+            unfinished = _mm256_subs_epu8(input, incomplete);
+            leads = _mm256_add_epi64(leads, _mm256_sad_epu8(
+                _mm256_and_si256(
+                    _mm256_cmpgt_epi8(input, _mm256_set1_epi8(-65)),
+                    _mm256_set1_epi8(1)), _mm256_setzero_si256()));
+        }
+        previous = input;
+    }
+
+    alignas(32) std::uint64_t sums[4];
+    _mm256_store_si256((__m256i*)sums, leads);
+    *__symbols = ascii + (size_t)(sums[0] + sums[1] + sums[2] + sums[3]);
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+
+TARGET_SSSE3 size_t
+internal::utf8_widen16_ssse3(
+    const unsigned char* __data,
+    size_t               __length,
+    char16_t*            __result) noexcept
+{
+    const auto zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= __length; i += 16) {
+        auto input = _mm_loadu_si128((const __m128i*)(__data + i));
+        if (_mm_movemask_epi8(input)) break;
+        auto output = (__m128i*)(__result + i);
+        _mm_storeu_si128(output + 0, _mm_unpacklo_epi8(input, zero));
+        _mm_storeu_si128(output + 1, _mm_unpackhi_epi8(input, zero));
+    }
+    return i;
+}
+
+
+TARGET_SSSE3 size_t
+internal::utf8_widen32_ssse3(
+    const unsigned char* __data,
+    size_t               __length,
+    char32_t*            __result) noexcept
+{
+    const auto zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= __length; i += 16) {
+        auto input = _mm_loadu_si128((const __m128i*)(__data + i));
+        if (_mm_movemask_epi8(input)) break;
+        auto low    = _mm_unpacklo_epi8(input, zero);
+        auto high   = _mm_unpackhi_epi8(input, zero);
+        auto output = (__m128i*)(__result + i);
+        _mm_storeu_si128(output + 0, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(output + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(output + 3, _mm_unpackhi_epi16(high, zero));
+    }
+    return i;
+}
+
+
+TARGET_SSSE3 size_t
+internal::utf8_narrow16_ssse3(
+    const char16_t* __data,
+    size_t          __length,
+    unsigned char*  __result) noexcept
+{
+    const auto ascii = _mm_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 16 <= __length; i += 16) {
+        auto input = (const __m128i*)(__data + i);
+        auto low   = _mm_loadu_si128(input + 0);
+        auto high  = _mm_loadu_si128(input + 1);
+        auto wide  = _mm_and_si128(_mm_or_si128(low, high), ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(wide, _mm_setzero_si128()))
+            != 0xFFFF) break;
+        _mm_storeu_si128((__m128i*)(__result + i),
+            _mm_packus_epi16(low, high));
+    }
+    return i;
+}
+
+
+TARGET_SSSE3 size_t
+internal::utf8_narrow32_ssse3(
+    const char32_t* __data,
+    size_t          __length,
+    unsigned char*  __result) noexcept
+{
+    const auto ascii = _mm_set1_epi32((int)0xFFFFFF80);
+    size_t i = 0;
+    for (; i + 16 <= __length; i += 16) {
+        auto input = (const __m128i*)(__data + i);
+        auto a = _mm_loadu_si128(input + 0);
+        auto b = _mm_loadu_si128(input + 1);
+        auto c = _mm_loadu_si128(input + 2);
+        auto d = _mm_loadu_si128(input + 3);
+        auto wide = _mm_and_si128(
+            _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(wide, _mm_setzero_si128()))
+            != 0xFFFF) break;
+        /* below 0x80, so the signed saturation never clips */
+        _mm_storeu_si128((__m128i*)(__result + i), _mm_packus_epi16(
+            _mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::utf8_widen16_avx2(
+    const unsigned char* __data,
+    size_t               __length,
+    char16_t*            __result) noexcept
+{
+    size_t i = 0;
+    for (; i + 32 <= __length; i += 32) {
+        auto input = (const __m128i*)(__data + i);
+        auto low   = _mm_loadu_si128(input + 0);
+        auto high  = _mm_loadu_si128(input + 1);
+        if (_mm_movemask_epi8(_mm_or_si128(low, high))) break;
+        auto output = (__m256i*)(__result + i);
+        _mm256_storeu_si256(output + 0, _mm256_cvtepu8_epi16(low));
+        _mm256_storeu_si256(output + 1, _mm256_cvtepu8_epi16(high));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::utf8_widen32_avx2(
+    const unsigned char* __data,
+    size_t               __length,
+    char32_t*            __result) noexcept
+{
+    size_t i = 0;
+    for (; i + 32 <= __length; i += 32) {
+        auto input = (const __m128i*)(__data + i);
+        auto low   = _mm_loadu_si128(input + 0);
+        auto high  = _mm_loadu_si128(input + 1);
+        if (_mm_movemask_epi8(_mm_or_si128(low, high))) break;
+        auto output = (__m256i*)(__result + i);
+        _mm256_storeu_si256(output + 0, _mm256_cvtepu8_epi32(low));
+        _mm256_storeu_si256(output + 1,
+            _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+        _mm256_storeu_si256(output + 2, _mm256_cvtepu8_epi32(high));
+        _mm256_storeu_si256(output + 3,
+            _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::utf8_narrow16_avx2(
+    const char16_t* __data,
+    size_t          __length,
+    unsigned char*  __result) noexcept
+{
+    const auto ascii = _mm256_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 32 <= __length; i += 32) {
+        auto input = (const __m256i*)(__data + i);
+        auto low   = _mm256_loadu_si256(input + 0);
+        auto high  = _mm256_loadu_si256(input + 1);
+        auto wide  = _mm256_and_si256(_mm256_or_si256(low, high), ascii);
+        if (!_mm256_testz_si256(wide, wide)) break;
+        /* packing works per 128-bit lane; put the quarters in order */
+        _mm256_storeu_si256((__m256i*)(__result + i),
+            _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8));
+    }
+    return i;
+}
+
+
+TARGET_AVX2 size_t
+internal::utf8_narrow32_avx2(
+    const char32_t* __data,
+    size_t          __length,
+    unsigned char*  __result) noexcept
+{
+    const auto ascii = _mm256_set1_epi32((int)0xFFFFFF80);
+    const auto order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= __length; i += 32) {
+        auto input = (const __m256i*)(__data + i);
+        auto a = _mm256_loadu_si256(input + 0);
+        auto b = _mm256_loadu_si256(input + 1);
+        auto c = _mm256_loadu_si256(input + 2);
+        auto d = _mm256_loadu_si256(input + 3);
+        auto wide = _mm256_and_si256(_mm256_or_si256(
+            _mm256_or_si256(a, b), _mm256_or_si256(c, d)), ascii);
+        if (!_mm256_testz_si256(wide, wide)) break;
+        auto bytes = _mm256_packus_epi16(
+            _mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i*)(__result + i),
+            _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    return i;
+}
+
+#endif /* HAVE_X86_SIMD */
@@ -7,6 +7,7 @@
 #include <stdexcept>
 
 #include "utils/impact_error.h"
+#include "utils/metrics.h"
 #include "sockets/generic.h"
 
 using namespace impact;
@@ -82,7 +83,11 @@ socketstream::underflow()
     }
 
     try {
-        auto status = impact::poll(&m_poll_handle_, m_timeout_);
+        int status;
+        {
+            metric_timer timer(metric_histogram::STREAM_WAIT);
+            status = impact::poll(&m_poll_handle_, m_timeout_);
+        }
 
         if (status == 0)
             return EOF; // timeout
@@ -102,6 +107,7 @@ socketstream::underflow()
             if (bytes_received == 0)
                 return EOF;
 
+            metrics::add(metric_counter::STREAM_READS);
             setg(eback(), eback(), eback() + bytes_received);
             return *eback();
         }
@@ -134,6 +140,7 @@ socketstream::_M_write_base(int __c)
         auto length = int(pptr() - pbase());
         m_handle_.send(pbase(), length);
         setp(pbase(), epptr());
+        metrics::add(metric_counter::STREAM_WRITES);
     }
     catch (...) { return EOF; }
 
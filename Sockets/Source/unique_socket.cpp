@@ -0,0 +1,338 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "sockets/unique_socket.h"
+#include "basic_socket_common.inc"
+
+#if !defined(__OS_WINDOWS__)
+    #include <fcntl.h>         // For fcntl(), O_NONBLOCK
+#endif
+
+using namespace impact;
+
+/* descriptor errors are left to the system call itself: an invalid
+   handle fails with EBADF, so no extra check is needed up front */
+
+
+unique_socket::unique_socket() noexcept
+: m_descriptor_(INVALID_SOCKET), m_traits_(0)
+{}
+
+
+unique_socket::unique_socket(unique_socket&& __rvalue) noexcept
+: m_descriptor_(__rvalue.m_descriptor_), m_traits_(__rvalue.m_traits_)
+{
+    __rvalue.m_descriptor_ = INVALID_SOCKET;
+}
+
+
+unique_socket::~unique_socket()
+{
+    if (m_descriptor_ != INVALID_SOCKET)
+        CLOSE_SOCKET(m_descriptor_);
+}
+
+
+unique_socket&
+unique_socket::operator=(unique_socket&& __rvalue) noexcept
+{
+    if (this != &__rvalue) {
+        if (m_descriptor_ != INVALID_SOCKET)
+            CLOSE_SOCKET(m_descriptor_);
+        m_descriptor_          = __rvalue.m_descriptor_;
+        m_traits_              = __rvalue.m_traits_;
+        __rvalue.m_descriptor_ = INVALID_SOCKET;
+    }
+    return *this;
+}
+
+
+int
+unique_socket::get() const noexcept
+{
+    return m_descriptor_;
+}
+
+
+address_family
+unique_socket::domain() const noexcept
+{
+    return (address_family)(m_traits_ & 0xFF);
+}
+
+
+socket_type
+unique_socket::type() const noexcept
+{
+    return (socket_type)((m_traits_ >> 8) & 0xFF);
+}
+
+
+internet_protocol
+unique_socket::protocol() const noexcept
+{
+    return (internet_protocol)(m_traits_ >> 16);
+}
+
+
+unique_socket::operator bool() const noexcept
+{
+    return m_descriptor_ != INVALID_SOCKET;
+}
+
+
+void
+unique_socket::close()
+{
+    auto status = CLOSE_SOCKET(m_descriptor_);
+    m_descriptor_ = INVALID_SOCKET;
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+int
+unique_socket::release() noexcept
+{
+    auto descriptor = m_descriptor_;
+    m_descriptor_   = INVALID_SOCKET;
+    return descriptor;
+}
+
+
+basic_socket
+unique_socket::share()
+{
+    if (m_descriptor_ == INVALID_SOCKET)
+        throw impact_error("Invalid socket");
+    auto result = adopt_socket(m_descriptor_, domain(), type(), protocol());
+    m_descriptor_ = INVALID_SOCKET;
+    return result;
+}
+
+
+void
+unique_socket::bind(unsigned short __port)
+{
+    struct sockaddr_in socket_address;
+
+    ::memset(&socket_address, 0, sizeof(socket_address));
+    socket_address.sin_family      = AF_INET;
+    socket_address.sin_addr.s_addr = htonl(INADDR_ANY);
+    socket_address.sin_port        = htons(__port);
+
+    auto status = ::bind(
+        m_descriptor_,
+        (struct sockaddr*)&socket_address,
+        sizeof(socket_address)
+    );
+
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+void
+unique_socket::connect(
+    unsigned short     __port,
+    const std::string& __address)
+{
+    std::shared_ptr<struct sockaddr> destination_address;
+
+    size_t size;
+    CATCH_ASSERT(
+        size = internal::fill_address(
+            domain(),
+            type(),
+            protocol(),
+            __address,
+            __port,
+            &destination_address
+        );
+    )
+
+    auto status = ::connect(
+        m_descriptor_,
+        destination_address.get(),
+        size
+    );
+
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+void
+unique_socket::listen(int __backlog)
+{
+    auto status = ::listen(m_descriptor_, __backlog);
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+unique_socket
+unique_socket::accept()
+{
+    unique_socket peer;
+    peer.m_descriptor_ = ::accept(m_descriptor_, NULL, NULL);
+    ASSERT(peer.m_descriptor_ != INVALID_SOCKET)
+    peer.m_traits_     = m_traits_;
+    return peer;
+}
+
+
+void
+unique_socket::shutdown(socket_channel __channel)
+{
+    auto status = ::shutdown(m_descriptor_, (int)__channel);
+    ASSERT(status != SOCKET_ERROR)
+}
+
+
+int
+unique_socket::send(
+    const void*   __buffer,
+    int           __length,
+    message_flags __flags)
+{
+    auto status = ::send(
+        m_descriptor_,
+        (CCHAR_PTR)__buffer,
+        __length,
+        (int)__flags
+    );
+    ASSERT(status != SOCKET_ERROR)
+    return (int)status;
+}
+
+
+int
+unique_socket::recv(
+    void*         __buffer,
+    int           __length,
+    message_flags __flags)
+{
+    auto status = ::recv(
+        m_descriptor_,
+        (CHAR_PTR)__buffer,
+        __length,
+        (int)__flags
+    );
+    ASSERT(status != SOCKET_ERROR)
+    return (int)status;
+}
+
+
+unsigned short
+unique_socket::local_port()
+{
+    struct sockaddr_storage address;
+    socklen_t address_length = sizeof(address);
+
+    auto status = ::getsockname(
+        m_descriptor_,
+        (struct sockaddr*)&address,
+        &address_length
+    );
+
+    ASSERT(status != SOCKET_ERROR)
+    if (address.ss_family == AF_INET6)
+        return ntohs(((struct sockaddr_in6*)&address)->sin6_port);
+    return ntohs(((struct sockaddr_in*)&address)->sin_port);
+}
+
+
+void
+unique_socket::non_blocking(bool __enabled)
+{
+#if defined(__OS_WINDOWS__)
+    u_long mode = __enabled ? 1 : 0;
+    auto status = ::ioctlsocket(m_descriptor_, FIONBIO, &mode);
+    ASSERT(status != SOCKET_ERROR)
+#else
+    auto flags = ::fcntl(m_descriptor_, F_GETFL, 0);
+    ASSERT(flags != SOCKET_ERROR)
+    flags = __enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    auto status = ::fcntl(m_descriptor_, F_SETFL, flags);
+    ASSERT(status != SOCKET_ERROR)
+#endif
+}
+
+
+std::uint32_t
+unique_socket::_S_pack(
+    address_family    __domain,
+    socket_type       __type,
+    internet_protocol __proto) noexcept
+{
+    return
+        ((std::uint32_t)__domain & 0xFF)        |
+        (((std::uint32_t)__type & 0xFF) << 8)   |
+        (((std::uint32_t)__proto & 0xFFFF) << 16);
+}
+
+
+unique_socket
+impact::make_unique_socket(
+    address_family    __domain,
+    socket_type       __type,
+    internet_protocol __proto)
+{
+#if defined(__OS_WINDOWS__)
+    /* unique handles don't track WSA ownership; start it once */
+    static struct wsa_guard {
+        int status;
+        wsa_guard() {
+            WSADATA wsa_data;
+            status = WSAStartup(MAKEWORD(2, 2), &wsa_data);
+        }
+    } wsa;
+    WIN_ASSERT(wsa.status == 0, wsa.status, (void)0;)
+#else
+    /* process-wide and sticky; only the first call does any work */
+    internal::no_sigpipe();
+#endif
+    unique_socket result;
+    result.m_descriptor_ = ::socket((int)__domain, (int)__type, (int)__proto);
+    ASSERT(result.m_descriptor_ != INVALID_SOCKET);
+    result.m_traits_     = unique_socket::_S_pack(__domain, __type, __proto);
+    return result;
+}
+
+
+unique_socket
+impact::make_unique_tcp_socket()
+{
+    CATCH_ASSERT(
+        return make_unique_socket(
+            address_family::INET,
+            socket_type::STREAM,
+            internet_protocol::TCP
+        );
+    )
+}
+
+
+unique_socket
+impact::make_unique_udp_socket()
+{
+    CATCH_ASSERT(
+        return make_unique_socket(
+            address_family::INET,
+            socket_type::DATAGRAM,
+            internet_protocol::UDP
+        );
+    )
+}
+
+
+unique_socket
+impact::adopt_unique_socket(
+    int               __descriptor,
+    address_family    __domain,
+    socket_type       __type,
+    internet_protocol __proto) noexcept
+{
+    unique_socket result;
+    result.m_descriptor_ = __descriptor;
+    result.m_traits_     = unique_socket::_S_pack(__domain, __type, __proto);
+    return result;
+}
@@ -0,0 +1,116 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "utils/cpu_features.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(HAVE_X86_SIMD)
+    #include <cpuid.h>
+#endif
+
+using namespace impact;
+
+namespace impact {
+namespace internal {
+    simd_level detect_simd() noexcept;
+}}
+
+
+internal::cpu_features::cpu_features()
+: sse2(false), ssse3(false), sse41(false), avx2(false), avx512f(false),
+  avx512bw(false), avx512vbmi(false), sha(false)
+{
+#if defined(HAVE_X86_SIMD)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return;
+    sse2  = (edx & (1U << 26)) != 0;
+    ssse3 = (ecx & (1U << 9))  != 0;
+    sse41 = (ecx & (1U << 19)) != 0;
+
+    /* wide registers are only usable when the OS saves them */
+    bool ymm = false, zmm = false;
+    if ((ecx & (1U << 27)) && (ecx & (1U << 28))) { /* OSXSAVE, AVX */
+        unsigned int xcr0_low, xcr0_high;
+        __asm__ volatile ("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+        (void)xcr0_high;
+        ymm = (xcr0_low & 0x06) == 0x06;
+        zmm = ymm && (xcr0_low & 0xE0) == 0xE0;
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return;
+    avx2       = ymm && (ebx & (1U << 5))  != 0;
+    avx512f    = zmm && (ebx & (1U << 16)) != 0;
+    avx512bw   = zmm && (ebx & (1U << 30)) != 0;
+    avx512vbmi = zmm && (ecx & (1U << 1))  != 0;
+    sha        = (ebx & (1U << 29)) != 0;
+#endif
+}
+
+
+const internal::cpu_features&
+internal::cpu() noexcept
+{
+    static const cpu_features features;
+    return features;
+}
+
+
+bool
+internal::simd_supported(simd_level __level) noexcept
+{
+    const auto& features = cpu();
+    switch (__level) {
+    case simd_level::SCALAR: return true;
+    case simd_level::SSSE3:  return features.ssse3;
+    case simd_level::AVX2:   return features.avx2;
+    case simd_level::AVX512:
+        return features.avx512f && features.avx512bw && features.avx512vbmi;
+    default: return false;
+    }
+}
+
+
+const char*
+internal::simd_name(simd_level __level) noexcept
+{
+    switch (__level) {
+    case simd_level::SCALAR: return "scalar";
+    case simd_level::SSSE3:  return "ssse3";
+    case simd_level::AVX2:   return "avx2";
+    case simd_level::AVX512: return "avx512";
+    default: return "unknown";
+    }
+}
+
+
+internal::simd_level
+internal::detect_simd() noexcept
+{
+    auto best = simd_level::SCALAR;
+    for (int i = 1; i < (int)simd_level::COUNT; i++) {
+        if (simd_supported((simd_level)i))
+            best = (simd_level)i;
+    }
+
+    auto cap = std::getenv("IMPACT_SIMD");
+    if (cap) {
+        for (int i = 0; i < (int)best; i++) {
+            if (std::strcmp(cap, simd_name((simd_level)i)) == 0)
+                return (simd_level)i;
+        }
+    }
+    return best;
+}
+
+
+internal::simd_level
+internal::simd() noexcept
+{
+    static const simd_level level = detect_simd();
+    return level;
+}
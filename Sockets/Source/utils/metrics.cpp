@@ -0,0 +1,418 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "utils/metrics.h"
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cerrno>
+
+#include "sockets/generic.h"
+
+#if defined(__OS_WINDOWS__)
+    #include <WinSock2.h>
+#endif
+
+using namespace impact;
+
+#define COUNTERS   ((size_t)metric_counter::COUNT)
+#define HISTOGRAMS ((size_t)metric_histogram::COUNT)
+
+namespace impact {
+namespace internal {
+    /* Written by one thread at a time (its lease holder), so updates
+       are plain relaxed load/store pairs instead of locked RMWs. */
+    struct metric_shard {
+        struct histogram {
+            std::atomic<std::uint64_t> count;
+            std::atomic<std::uint64_t> sum;
+            std::atomic<std::uint64_t> min;
+            std::atomic<std::uint64_t> max;
+            std::atomic<std::uint64_t>
+                buckets[histogram_snapshot::k_buckets];
+        };
+
+        std::atomic<std::uint64_t> counters[COUNTERS];
+        histogram                  histograms[HISTOGRAMS];
+
+        metric_shard();
+        void clear() noexcept;
+    };
+
+    /* shards outlive their threads: a finished thread's counts stay in
+       the totals and its shard is handed to the next new thread */
+    struct metric_registry {
+        std::mutex                                 mtx;
+        std::vector<std::unique_ptr<metric_shard>> shards;
+        std::vector<metric_shard*>                 vacant;
+    };
+
+    struct metric_lease {
+        metric_shard* shard;
+        metric_lease();
+        ~metric_lease();
+    };
+
+    metric_registry& registry();
+    metric_shard& local_shard();
+    void bump(std::atomic<std::uint64_t>& value, std::uint64_t amount)
+        noexcept;
+    std::string prometheus_name(const char* name);
+}}
+
+
+const unsigned int histogram_snapshot::k_sub_bits;
+const size_t histogram_snapshot::k_buckets;
+
+
+histogram_snapshot::histogram_snapshot()
+: count(0), sum(0), min(0), max(0), buckets(k_buckets, 0)
+{}
+
+
+size_t
+histogram_snapshot::bucket_of(std::uint64_t __value) noexcept
+{
+    const std::uint64_t k_linear = (std::uint64_t)1 << k_sub_bits;
+    if (__value < k_linear) return (size_t)__value;
+    unsigned int msb = 63;
+    while (!(__value >> msb)) msb--;
+    unsigned int shift = msb - k_sub_bits;
+    return ((size_t)(shift + 1) << k_sub_bits) |
+        (size_t)((__value >> shift) & (k_linear - 1));
+}
+
+
+std::uint64_t
+histogram_snapshot::bucket_low(size_t __index) noexcept
+{
+    const std::uint64_t k_linear = (std::uint64_t)1 << k_sub_bits;
+    if (__index < k_linear) return __index;
+    unsigned int shift = (unsigned int)(__index >> k_sub_bits) - 1;
+    return (k_linear | (__index & (k_linear - 1))) << shift;
+}
+
+
+std::uint64_t
+histogram_snapshot::bucket_high(size_t __index) noexcept
+{
+    if (__index < ((size_t)1 << k_sub_bits)) return __index;
+    unsigned int shift = (unsigned int)(__index >> k_sub_bits) - 1;
+    return bucket_low(__index) + (((std::uint64_t)1 << shift) - 1);
+}
+
+
+std::uint64_t
+histogram_snapshot::percentile(double __fraction) const noexcept
+{
+    if (count == 0) return 0;
+    if (__fraction <= 0) return min;
+    if (__fraction >= 1) return max;
+    auto target = (std::uint64_t)(__fraction * (double)count);
+    if (target == 0) target = 1;
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            auto high = bucket_high(i);
+            return high < max ? high : max;
+        }
+    }
+    return max;
+}
+
+
+double
+histogram_snapshot::mean() const noexcept
+{
+    return count ? (double)sum / (double)count : 0.0;
+}
+
+
+metrics_snapshot::metrics_snapshot()
+{
+    for (size_t i = 0; i < COUNTERS; i++)
+        counters[i] = 0;
+}
+
+
+std::uint64_t
+metrics_snapshot::counter(metric_counter __id) const noexcept
+{
+    return counters[(size_t)__id];
+}
+
+
+const struct histogram_snapshot&
+metrics_snapshot::histogram(metric_histogram __id) const noexcept
+{
+    return histograms[(size_t)__id];
+}
+
+
+internal::metric_shard::metric_shard()
+{ clear(); }
+
+
+void
+internal::metric_shard::clear() noexcept
+{
+    for (auto& counter : counters)
+        counter.store(0, std::memory_order_relaxed);
+    for (auto& entry : histograms) {
+        entry.count.store(0, std::memory_order_relaxed);
+        entry.sum.store(0, std::memory_order_relaxed);
+        entry.min.store(std::numeric_limits<std::uint64_t>::max(),
+            std::memory_order_relaxed);
+        entry.max.store(0, std::memory_order_relaxed);
+        for (auto& bucket : entry.buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+
+internal::metric_registry&
+internal::registry()
+{
+    /* never destroyed: thread_local leases may be released after
+       static destructors have run */
+    static metric_registry* unit = new metric_registry();
+    return *unit;
+}
+
+
+internal::metric_lease::metric_lease()
+{
+    auto& unit = registry();
+    std::lock_guard<std::mutex> lock(unit.mtx);
+    if (unit.vacant.empty()) {
+        unit.shards.emplace_back(new metric_shard());
+        shard = unit.shards.back().get();
+    }
+    else {
+        shard = unit.vacant.back();
+        unit.vacant.pop_back();
+    }
+}
+
+
+internal::metric_lease::~metric_lease()
+{
+    auto& unit = registry();
+    std::lock_guard<std::mutex> lock(unit.mtx);
+    unit.vacant.push_back(shard);
+}
+
+
+internal::metric_shard&
+internal::local_shard()
+{
+    static thread_local metric_lease lease;
+    return *lease.shard;
+}
+
+
+void
+internal::bump(
+    std::atomic<std::uint64_t>& __value,
+    std::uint64_t               __amount) noexcept
+{
+    __value.store(__value.load(std::memory_order_relaxed) + __amount,
+        std::memory_order_relaxed);
+}
+
+
+#if !defined(IMPACT_NO_METRICS)
+
+void
+metrics::add(
+    metric_counter __id,
+    std::uint64_t  __amount) noexcept
+{
+    internal::bump(internal::local_shard().counters[(size_t)__id], __amount);
+}
+
+
+void
+metrics::record(
+    metric_histogram __id,
+    std::uint64_t    __value) noexcept
+{
+    auto& entry = internal::local_shard().histograms[(size_t)__id];
+    internal::bump(entry.count, 1);
+    internal::bump(entry.sum, __value);
+    internal::bump(entry.buckets[histogram_snapshot::bucket_of(__value)], 1);
+    if (__value < entry.min.load(std::memory_order_relaxed))
+        entry.min.store(__value, std::memory_order_relaxed);
+    if (__value > entry.max.load(std::memory_order_relaxed))
+        entry.max.store(__value, std::memory_order_relaxed);
+}
+
+
+void
+internal::count_error() noexcept
+{
+    /* callers still report this error; don't let a first-use shard
+       allocation disturb it */
+    auto code = error_code();
+#if defined(__OS_WINDOWS__)
+    auto blocked = code == WSAEWOULDBLOCK;
+#else
+    auto blocked = code == EAGAIN || code == EWOULDBLOCK;
+#endif
+    metrics::add(blocked ?
+        metric_counter::WOULD_BLOCK : metric_counter::SOCKET_ERRORS);
+#if defined(__OS_WINDOWS__)
+    WSASetLastError(code);
+#else
+    errno = code;
+#endif
+}
+
+
+void
+internal::count_io(
+    metric_counter __calls,
+    metric_counter __bytes,
+    long           __status) noexcept
+{
+    if (__status < 0) count_error(); /* reads errno first */
+    auto& shard = local_shard();
+    bump(shard.counters[(size_t)__calls], 1);
+    if (__status >= 0)
+        bump(shard.counters[(size_t)__bytes], (std::uint64_t)__status);
+}
+
+#endif /* IMPACT_NO_METRICS */
+
+
+struct metrics_snapshot
+metrics::snapshot()
+{
+    struct metrics_snapshot result;
+    auto& unit = internal::registry();
+    std::lock_guard<std::mutex> lock(unit.mtx);
+
+    for (size_t h = 0; h < HISTOGRAMS; h++)
+        result.histograms[h].min = std::numeric_limits<std::uint64_t>::max();
+
+    for (const auto& shard : unit.shards) {
+        for (size_t c = 0; c < COUNTERS; c++)
+            result.counters[c] +=
+                shard->counters[c].load(std::memory_order_relaxed);
+        for (size_t h = 0; h < HISTOGRAMS; h++) {
+            auto& source = shard->histograms[h];
+            auto& target = result.histograms[h];
+            target.count += source.count.load(std::memory_order_relaxed);
+            target.sum   += source.sum.load(std::memory_order_relaxed);
+            auto low  = source.min.load(std::memory_order_relaxed);
+            auto high = source.max.load(std::memory_order_relaxed);
+            if (low < target.min)  target.min = low;
+            if (high > target.max) target.max = high;
+            for (size_t b = 0; b < histogram_snapshot::k_buckets; b++)
+                target.buckets[b] +=
+                    source.buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+
+    for (size_t h = 0; h < HISTOGRAMS; h++) {
+        if (result.histograms[h].count == 0)
+            result.histograms[h].min = 0;
+    }
+    return result;
+}
+
+
+void
+metrics::reset()
+{
+    auto& unit = internal::registry();
+    std::lock_guard<std::mutex> lock(unit.mtx);
+    for (const auto& shard : unit.shards)
+        shard->clear();
+}
+
+
+const char*
+metrics::name(metric_counter __id) noexcept
+{
+    switch (__id) {
+    case metric_counter::BYTES_SENT:          return "bytes_sent";
+    case metric_counter::BYTES_RECEIVED:      return "bytes_received";
+    case metric_counter::SEND_CALLS:          return "send_calls";
+    case metric_counter::RECV_CALLS:          return "recv_calls";
+    case metric_counter::WOULD_BLOCK:         return "would_block";
+    case metric_counter::SOCKET_ERRORS:       return "socket_errors";
+    case metric_counter::ACCEPTS:             return "accepts";
+    case metric_counter::CONNECTS:            return "connects";
+    case metric_counter::PIPELINE_ITERATIONS: return "pipeline_iterations";
+    case metric_counter::PIPELINE_CALLBACKS:  return "pipeline_callbacks";
+    case metric_counter::SLOW_CALLBACKS:      return "slow_callbacks";
+    case metric_counter::STREAM_READS:        return "stream_reads";
+    case metric_counter::STREAM_WRITES:       return "stream_writes";
+    default:                                  return "unknown";
+    }
+}
+
+
+const char*
+metrics::name(metric_histogram __id) noexcept
+{
+    switch (__id) {
+    case metric_histogram::PIPELINE_LOOP:     return "pipeline_loop";
+    case metric_histogram::PIPELINE_POLL:     return "pipeline_poll";
+    case metric_histogram::PIPELINE_CALLBACK: return "pipeline_callback";
+    case metric_histogram::PIPELINE_LAG:      return "pipeline_lag";
+    case metric_histogram::STREAM_WAIT:       return "stream_wait";
+    default:                                  return "unknown";
+    }
+}
+
+
+std::string
+internal::prometheus_name(const char* __name)
+{
+    return std::string("impact_") + __name;
+}
+
+
+std::string
+metrics::prometheus()
+{
+    return prometheus(snapshot());
+}
+
+
+std::string
+metrics::prometheus(const struct metrics_snapshot& __snapshot)
+{
+    static const double k_quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+    std::ostringstream os;
+    os << std::setprecision(9);
+
+    for (size_t c = 0; c < COUNTERS; c++) {
+        auto label = internal::prometheus_name(name((metric_counter)c));
+        os << "# TYPE " << label << "_total counter\n";
+        os << label << "_total " << __snapshot.counters[c] << "\n";
+    }
+
+    /* histograms are exported as summaries, in seconds */
+    for (size_t h = 0; h < HISTOGRAMS; h++) {
+        auto label = internal::prometheus_name(name((metric_histogram)h)) +
+            "_seconds";
+        const auto& histogram = __snapshot.histograms[h];
+        os << "# TYPE " << label << " summary\n";
+        for (auto quantile : k_quantiles) {
+            os << label << "{quantile=\"" << quantile << "\"} " <<
+                (double)histogram.percentile(quantile) / 1e9 << "\n";
+        }
+        os << label << "_sum " << (double)histogram.sum / 1e9 << "\n";
+        os << label << "_count " << histogram.count << "\n";
+    }
+    return os.str();
+}
@@ -0,0 +1,423 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include "utils/thread_pool.h"
+
+#include "utils/impact_error.h"
+
+#if defined(__OS_LINUX__)
+    #include <pthread.h>       // pthread_setaffinity_np()
+    #include <sched.h>         // cpu_set_t
+    #include <unistd.h>        // syscall()
+    #include <sys/syscall.h>   // SYS_futex
+    #include <linux/futex.h>   // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#endif
+
+using namespace impact;
+using namespace internal;
+
+namespace impact {
+namespace internal {
+    /* the pool and worker index of the calling thread, if any */
+    thread_local const thread_pool* _t_current_pool_   = nullptr;
+    thread_local size_t             _t_current_worker_ = 0;
+}}
+
+
+thread_pool::options::options()
+: threads(0), pin_threads(false), first_cpu(0)
+{}
+
+
+thread_pool::thread_pool(struct options __options)
+{
+    m_injected_size_ = 0;
+    m_sleeping_      = 0;
+    m_shutting_down_ = false;
+
+    auto count = __options.threads;
+    if (count == 0) count = std::thread::hardware_concurrency();
+    if (count == 0) count = 1;
+
+    for (unsigned int i = 0; i < count; i++) {
+        m_workers_.emplace_back(new worker());
+        m_workers_.back()->idle = false;
+        m_workers_.back()->seed = 2463534242U + i;
+    }
+
+    /* start only once every worker exists so stealing never races setup */
+    for (unsigned int i = 0; i < count; i++) {
+        m_workers_[i]->thread = std::thread([this, i](){ _M_run(i); });
+        if (__options.pin_threads)
+            _M_pin(i, __options.first_cpu + i);
+    }
+}
+
+
+thread_pool::~thread_pool()
+{
+    {
+        /* submit() checks the flag under this lock, so nothing new
+           is injected once it is set */
+        std::lock_guard<std::mutex> lock(m_inject_mtx_);
+        m_shutting_down_ = true;
+    }
+    for (auto& target : m_workers_)
+        target->park.unpark();
+    for (auto& target : m_workers_) {
+        if (target->thread.joinable())
+            target->thread.join();
+    }
+    /* workers drain all queues before exiting; free anything left */
+    for (auto work : m_injected_)
+        delete work;
+    m_injected_.clear();
+}
+
+
+void
+thread_pool::submit(task __work)
+{
+    /* workers may still fan out while the pool drains */
+    if (m_shutting_down_ && _t_current_pool_ != this)
+        throw impact_error("Thread pool is shutting down");
+
+    if (_t_current_pool_ == this)
+        m_workers_[_t_current_worker_]->deque.push(
+            new task(std::move(__work)));
+    else {
+        std::lock_guard<std::mutex> lock(m_inject_mtx_);
+        /* the destructor may have set the flag since the check above */
+        if (m_shutting_down_)
+            throw impact_error("Thread pool is shutting down");
+        m_injected_.push_back(new task(std::move(__work)));
+        m_injected_size_++;
+    }
+
+    /* pairs with the fence in _M_run: either we see the sleeper
+       or the sleeper sees the work we just published */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleeping_ > 0)
+        _M_wake_one();
+}
+
+
+size_t
+thread_pool::size() const noexcept
+{
+    return m_workers_.size();
+}
+
+
+bool
+thread_pool::in_pool() const noexcept
+{
+    return _t_current_pool_ == this;
+}
+
+
+void
+thread_pool::_M_run(size_t __index)
+{
+    _t_current_pool_   = this;
+    _t_current_worker_ = __index;
+    auto& self = *m_workers_[__index];
+
+    do {
+        auto work = _M_find_work(__index);
+        if (work) {
+            try { (*work)(); } catch (...) { /* keep the worker alive */ }
+            delete work;
+            continue;
+        }
+
+        /* the flag is set after the last injection, so once it reads
+           true a second look sees everything submitted before it */
+        if (m_shutting_down_ && !_M_has_visible_work()) break;
+
+        self.idle = true;
+        m_sleeping_++;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_M_has_visible_work() || m_shutting_down_) {
+            if (self.idle.exchange(false))
+                m_sleeping_--;
+            else self.park.park(); /* a waker claimed us; consume its token */
+            continue;
+        }
+        self.park.park();
+    } while (true);
+
+    _t_current_pool_ = nullptr;
+}
+
+
+thread_pool::task*
+thread_pool::_M_find_work(size_t __index)
+{
+    auto& self = *m_workers_[__index];
+
+    auto work = self.deque.take();
+    if (work) return work;
+
+    work = _M_pop_injected();
+    if (work) return work;
+
+    /* xorshift32 to pick a random first victim */
+    self.seed ^= self.seed << 13;
+    self.seed ^= self.seed >> 17;
+    self.seed ^= self.seed << 5;
+    auto count = m_workers_.size();
+    auto start = self.seed % count;
+    for (size_t i = 0; i < count; i++) {
+        auto victim = (start + i) % count;
+        if (victim == __index) continue;
+        work = m_workers_[victim]->deque.steal();
+        if (work) return work;
+    }
+    return nullptr;
+}
+
+
+thread_pool::task*
+thread_pool::_M_pop_injected()
+{
+    if (m_injected_size_ == 0)
+        return nullptr;
+    std::lock_guard<std::mutex> lock(m_inject_mtx_);
+    if (m_injected_.empty())
+        return nullptr;
+    auto work = m_injected_.front();
+    m_injected_.pop_front();
+    m_injected_size_--;
+    return work;
+}
+
+
+bool
+thread_pool::_M_has_visible_work() const
+{
+    if (m_injected_size_ > 0) return true;
+    for (const auto& target : m_workers_) {
+        if (!target->deque.empty())
+            return true;
+    }
+    return false;
+}
+
+
+void
+thread_pool::_M_wake_one()
+{
+    for (auto& target : m_workers_) {
+        if (target->idle && target->idle.exchange(false)) {
+            m_sleeping_--;
+            target->park.unpark();
+            return;
+        }
+    }
+}
+
+
+void
+thread_pool::_M_pin(
+    size_t       __index,
+    unsigned int __cpu)
+{
+#if defined(__OS_LINUX__)
+    auto cpus = std::thread::hardware_concurrency();
+    if (cpus == 0) return;
+    /* CPU_SET declares its own '__cpu'; don't pass ours through it */
+    unsigned int target = __cpu % cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(target, &set);
+    /* best effort: an unpinned worker is still a working worker */
+    ::pthread_setaffinity_np(
+        m_workers_[__index]->thread.native_handle(),
+        sizeof(set),
+        &set
+    );
+#else
+    UNUSED(__index);
+    UNUSED(__cpu);
+#endif
+}
+
+
+/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - *\
+|  Chase-Lev Work Deque Function Implementations                              |
+|  "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al.    |
+\* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+
+thread_pool::work_deque::ring::ring(long long __capacity)
+: capacity(__capacity), buffer(new std::atomic<task*>[__capacity])
+{}
+
+
+thread_pool::task*
+thread_pool::work_deque::ring::get(long long __index) const noexcept
+{
+    return buffer[__index & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+
+void
+thread_pool::work_deque::ring::put(
+    long long __index,
+    task*     __work) noexcept
+{
+    buffer[__index & (capacity - 1)].store(__work, std::memory_order_relaxed);
+}
+
+
+thread_pool::work_deque::work_deque()
+{
+    m_top_    = 0;
+    m_bottom_ = 0;
+    m_ring_   = new ring(64);
+}
+
+
+thread_pool::work_deque::~work_deque()
+{
+    auto current = m_ring_.load(std::memory_order_relaxed);
+    for (auto i = m_top_.load(); i < m_bottom_.load(); i++)
+        delete current->get(i);
+    delete current;
+}
+
+
+void
+thread_pool::work_deque::push(task* __work)
+{
+    auto bottom  = m_bottom_.load(std::memory_order_relaxed);
+    auto top     = m_top_.load(std::memory_order_acquire);
+    auto current = m_ring_.load(std::memory_order_relaxed);
+    if (bottom - top > current->capacity - 1)
+        current = _M_grow(current, bottom, top);
+    current->put(bottom, __work);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+
+thread_pool::task*
+thread_pool::work_deque::take()
+{
+    auto bottom  = m_bottom_.load(std::memory_order_relaxed) - 1;
+    auto current = m_ring_.load(std::memory_order_relaxed);
+    m_bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = m_top_.load(std::memory_order_relaxed);
+
+    task* work = nullptr;
+    if (top <= bottom) {
+        work = current->get(bottom);
+        if (top == bottom) {
+            /* last item: race the thieves for it */
+            if (!m_top_.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed))
+                work = nullptr;
+            m_bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else m_bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return work;
+}
+
+
+thread_pool::task*
+thread_pool::work_deque::steal()
+{
+    auto top = m_top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = m_bottom_.load(std::memory_order_acquire);
+
+    if (top < bottom) {
+        auto current = m_ring_.load(std::memory_order_acquire);
+        auto work    = current->get(top);
+        if (!m_top_.compare_exchange_strong(top, top + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr; /* lost the race */
+        return work;
+    }
+    return nullptr;
+}
+
+
+bool
+thread_pool::work_deque::empty() const noexcept
+{
+    return m_bottom_.load(std::memory_order_acquire) <=
+        m_top_.load(std::memory_order_acquire);
+}
+
+
+thread_pool::work_deque::ring*
+thread_pool::work_deque::_M_grow(
+    ring*     __current,
+    long long __bottom,
+    long long __top)
+{
+    auto larger = new ring(__current->capacity * 2);
+    for (auto i = __top; i < __bottom; i++)
+        larger->put(i, __current->get(i));
+    /* thieves may still read the old ring; retire it with the deque */
+    m_retired_.emplace_back(__current);
+    m_ring_.store(larger, std::memory_order_release);
+    return larger;
+}
+
+
+/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - *\
+|  Parker Function Implementations                                            |
+\* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+
+thread_pool::parker::parker()
+{
+    m_state_ = 0;
+}
+
+
+void
+thread_pool::parker::park()
+{
+    /* consume a pending token without sleeping */
+    if (m_state_.fetch_sub(1) == 1)
+        return;
+
+#if defined(__OS_LINUX__)
+    do {
+        ::syscall(SYS_futex, reinterpret_cast<int*>(&m_state_),
+            FUTEX_WAIT_PRIVATE, -1, NULL, NULL, 0);
+        int expected = 1;
+        if (m_state_.compare_exchange_strong(expected, 0))
+            return;
+    } while (true);
+#else
+    std::unique_lock<std::mutex> lock(m_mtx_);
+    m_cv_.wait(lock, [&]() -> bool {
+        int expected = 1;
+        return m_state_.compare_exchange_strong(expected, 0);
+    });
+#endif
+}
+
+
+void
+thread_pool::parker::unpark()
+{
+    if (m_state_.exchange(1) != -1)
+        return; /* not parked; the token is left for the next park() */
+
+#if defined(__OS_LINUX__)
+    ::syscall(SYS_futex, reinterpret_cast<int*>(&m_state_),
+        FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    { std::lock_guard<std::mutex> lock(m_mtx_); }
+    m_cv_.notify_one();
+#endif
+}
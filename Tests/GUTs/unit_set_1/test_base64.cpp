@@ -3,9 +3,40 @@
  */
 
 #include <iostream>
+#include <sstream>
+#include <random>
 
 #include <gtest/gtest.h>
 #include <rfc/base64.h>
+#include <utils/errno.h>
+#include <utils/cpu_features.h>
+
+namespace impact {
+    class test_base64_c {
+    public:
+        static std::string encode(const std::string& __data,
+            internal::simd_level __level,
+            const base64::options& __variant = base64::options()) {
+            std::string result(base64::encoded_size(__data.size()), '\0');
+            result.resize(base64::_S_encode(
+                (const unsigned char*)__data.data(), __data.size(),
+                &result[0], (int)__level, __variant));
+            return result;
+        }
+        static bool decode(const std::string& __data, std::string* __result,
+            internal::simd_level __level,
+            const base64::options& __variant = base64::options()) {
+            /* one spare byte, so a stray write past the end shows up */
+            std::string buffer(base64::decoded_size(__data.size()) + 1, '~');
+            size_t written = 0;
+            bool ok = base64::_S_decode(__data.data(), __data.size(),
+                (unsigned char*)&buffer[0], &written, (int)__level, __variant);
+            EXPECT_EQ(buffer.back(), '~');
+            __result->assign(buffer, 0, written);
+            return ok;
+        }
+    };
+}
 
 using namespace impact;
 
@@ -80,4 +111,287 @@ TEST(test_base64, decode) {
     
     std::string test;
     EXPECT_FALSE(base64::decode("illegal.chars", &test));
-}
\ No newline at end of file
+
+    /* a failed decode leaves the result untouched */
+    std::string kept = "untouched";
+    EXPECT_FALSE(base64::decode("Zm9vYmFy*mFy", &kept));
+    EXPECT_EQ(kept, "untouched");
+
+    /* without a result the input is only validated */
+    std::string large;
+    EXPECT_TRUE(base64::encode(std::string(10000, 'x'), &large));
+    EXPECT_TRUE(base64::decode(large, NULL));
+    large[large.size() - 8] = '*';
+    EXPECT_FALSE(base64::decode(large, NULL));
+    EXPECT_FALSE(base64::decode("Zm9", NULL));
+}
+TEST(test_base64, buffers) {
+    EXPECT_EQ(base64::encoded_size(0), 0U);
+    EXPECT_EQ(base64::encoded_size(1), 4U);
+    EXPECT_EQ(base64::encoded_size(3), 4U);
+    EXPECT_EQ(base64::encoded_size(4), 8U);
+    EXPECT_GE(base64::decoded_size(8), 6U);
+
+    char encoded[8];
+    EXPECT_EQ(base64::encode("foob", 4, encoded), 8U);
+    EXPECT_EQ(std::string(encoded, 8), "Zm9vYg==");
+
+    unsigned char decoded[6];
+    size_t written = 0;
+    EXPECT_TRUE(base64::decode(encoded, 8, decoded, &written));
+    EXPECT_EQ(written, 4U);
+    EXPECT_EQ(std::string((char*)decoded, written), "foob");
+
+    EXPECT_FALSE(base64::decode("Zm9v*mFy", 8, decoded, &written));
+    EXPECT_FALSE(base64::decode("Zm9vY", 5, decoded, &written));
+}
+
+TEST(test_base64, round_trip) {
+    std::string data;
+    for (int i = 0; i < 1024; i++) {
+        data.push_back((char)((i * 131 + 7) & 0xFF));
+        std::string encoded, decoded;
+        EXPECT_TRUE(base64::encode(data, &encoded));
+        EXPECT_EQ(encoded.size(), base64::encoded_size(data.size()));
+        EXPECT_TRUE(base64::decode(encoded, &decoded));
+        ASSERT_EQ(decoded, data);
+    }
+}
+
+TEST(test_base64, lenient) {
+    /* stray pads inside the data are skipped */
+    std::string result;
+    EXPECT_TRUE(base64::decode("Zm=9v", &result));
+    EXPECT_EQ(result, "foo");
+    EXPECT_TRUE(base64::decode("Zm9v=YmFy", &result));
+    EXPECT_EQ(result, "foobar");
+    EXPECT_FALSE(base64::decode("Zm9vY===", &result));
+    EXPECT_FALSE(base64::decode("====", &result));
+    EXPECT_FALSE(base64::decode("Zm9", &result));
+}
+
+TEST(test_base64, simd_kernels) {
+    /* every kernel this CPU runs must agree with the scalar code */
+    using test = test_base64_c;
+    using internal::simd_level;
+    std::mt19937 engine(2026);
+
+    for (int l = 1; l < (int)simd_level::COUNT; l++) {
+    for (auto variant : { base64::options(), base64::options::url() }) {
+        auto level = (simd_level)l;
+        if (!internal::simd_supported(level)) continue;
+        SCOPED_TRACE(internal::simd_name(level));
+        SCOPED_TRACE(variant.url_safe ? "url" : "standard");
+        const auto scalar_level = simd_level::SCALAR;
+
+        for (size_t size = 0; size < 700; size++) {
+            std::string data(size, '\0');
+            for (auto& c : data) c = (char)(engine() & 0xFF);
+
+            auto encoded = test::encode(data, scalar_level, variant);
+            ASSERT_EQ(test::encode(data, level, variant), encoded);
+            std::string decoded;
+            ASSERT_TRUE(test::decode(encoded, &decoded, level, variant));
+            ASSERT_EQ(decoded, data);
+            if (encoded.empty()) continue;
+
+            /* one corrupted symbol anywhere */
+            auto position = engine() % encoded.size();
+            encoded[position] = (char)(engine() & 0xFF);
+            std::string expected;
+            bool scalar = test::decode(encoded, &expected, scalar_level,
+                variant);
+            auto scalar_errno = imp_errno;
+            ASSERT_EQ(test::decode(encoded, &decoded, level, variant),
+                scalar);
+            ASSERT_EQ(imp_errno, scalar_errno);
+            if (scalar) { ASSERT_EQ(decoded, expected); }
+        }
+
+        /* every byte value in every lane of the widest block */
+        std::string data(192, '\0');
+        for (auto& c : data) c = (char)(engine() & 0xFF);
+        auto encoded = test::encode(data, scalar_level, variant);
+        for (size_t position = 0; position < 64; position++) {
+            for (int value = 0; value < 256; value++) {
+                auto mutated = encoded;
+                mutated[position] = (char)value;
+                std::string expected, decoded;
+                bool scalar = test::decode(mutated, &expected, scalar_level,
+                    variant);
+                ASSERT_EQ(test::decode(mutated, &decoded, level, variant),
+                    scalar) << position << " " << value;
+                if (scalar) { ASSERT_EQ(decoded, expected); }
+            }
+        }
+    }
+    }
+}
+
+TEST(test_base64, streaming) {
+    std::mt19937 engine(7);
+    for (size_t size = 0; size < 300; size++) {
+        std::string data(size, '\0');
+        for (auto& c : data) c = (char)(engine() & 0xFF);
+        std::string expected;
+        base64::encode(data, &expected);
+
+        /* random chunking must not change either direction */
+        base64::encoder encoder;
+        std::string encoded;
+        for (size_t i = 0; i < size;) {
+            auto chunk = std::min<size_t>(engine() % 8, size - i);
+            encoder.update(data.substr(i, chunk), &encoded);
+            i += chunk;
+        }
+        encoder.finish(&encoded);
+        ASSERT_EQ(encoded, expected);
+
+        base64::decoder decoder;
+        std::string decoded;
+        for (size_t i = 0; i < encoded.size();) {
+            auto chunk = std::min<size_t>(engine() % 80, encoded.size() - i);
+            ASSERT_TRUE(decoder.update(encoded.substr(i, chunk), &decoded));
+            i += chunk;
+        }
+        ASSERT_TRUE(decoder.finish(&decoded));
+        ASSERT_EQ(decoded, data);
+    }
+
+    /* same rules as the one-shot decoder */
+    const char* cases[] = {
+        "Zm=9v", "Zm9v=YmFy", "Zm9vY===", "====", "Zm9", "Zm9v==",
+        "Zm9vYg==", "Zm9vYmE=", "Zm9v*mFy"
+    };
+    for (auto text : cases) {
+        std::string expected, decoded;
+        bool whole = base64::decode(text, &expected);
+        base64::decoder decoder;
+        bool streamed = true;
+        for (const char* c = text; *c; c++)
+            streamed = decoder.update(std::string(1, *c), &decoded) &&
+                streamed;
+        streamed = decoder.finish(&decoded) && streamed;
+        EXPECT_EQ(streamed, whole) << text;
+        if (whole) { EXPECT_EQ(decoded, expected) << text; }
+    }
+
+    /* an error sticks until reset() */
+    base64::decoder decoder;
+    std::string decoded;
+    EXPECT_FALSE(decoder.update("Zm9v*", &decoded));
+    EXPECT_FALSE(decoder.update("YmFy", &decoded));
+    decoder.reset();
+    EXPECT_TRUE(decoder.update("YmFy", &decoded));
+    EXPECT_TRUE(decoder.finish(&decoded));
+    EXPECT_EQ(decoded.substr(decoded.size() - 3), "bar");
+}
+
+TEST(test_base64, streams) {
+    std::string data(100000, '\0');
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (char)((i * 7 + i / 251) & 0xFF);
+
+    std::istringstream plain(data);
+    std::ostringstream encoded;
+    ASSERT_TRUE(base64::encode(plain, encoded));
+    std::string expected;
+    base64::encode(data, &expected);
+    EXPECT_EQ(encoded.str(), expected);
+
+    std::istringstream text(encoded.str());
+    std::ostringstream decoded;
+    ASSERT_TRUE(base64::decode(text, decoded));
+    EXPECT_EQ(decoded.str(), data);
+
+    std::istringstream broken("Zm9v!mFy");
+    std::ostringstream ignored;
+    EXPECT_FALSE(base64::decode(broken, ignored));
+}
+
+TEST(test_base64, variants) {
+    std::mt19937 engine(4648);
+    const auto url  = base64::options::url();
+    const auto mime = base64::options::mime();
+
+    for (size_t size = 0; size < 400; size++) {
+        std::string data(size, '\0');
+        for (auto& c : data) c = (char)(engine() & 0xFF);
+        std::string standard;
+        base64::encode(data, &standard);
+
+        /* references built by post-processing the standard text */
+        std::string url_text;
+        for (auto c : standard) {
+            if (c == '+') url_text.push_back('-');
+            else if (c == '/') url_text.push_back('_');
+            else if (c != '=') url_text.push_back(c);
+        }
+        std::string mime_text;
+        for (size_t i = 0; i < standard.size(); i += 76) {
+            if (i) mime_text += "\r\n";
+            mime_text += standard.substr(i, 76);
+        }
+
+        std::string encoded, decoded;
+        EXPECT_TRUE(base64::encode(data, &encoded, url));
+        ASSERT_EQ(encoded, url_text);
+        ASSERT_EQ(base64::encoded_size(size, url), url_text.size());
+        ASSERT_TRUE(base64::decode(encoded, &decoded, url));
+        ASSERT_EQ(decoded, data);
+
+        EXPECT_TRUE(base64::encode(data, &encoded, mime));
+        ASSERT_EQ(encoded, mime_text);
+        ASSERT_EQ(base64::encoded_size(size, mime), mime_text.size());
+        ASSERT_TRUE(base64::decode(encoded, &decoded, mime));
+        ASSERT_EQ(decoded, data);
+
+        /* chunked, across line and group boundaries */
+        base64::encoder encoder(mime);
+        base64::decoder decoder(mime);
+        std::string streamed, restored;
+        for (size_t i = 0; i < size;) {
+            auto chunk = std::min<size_t>(engine() % 100, size - i);
+            encoder.update(data.substr(i, chunk), &streamed);
+            i += chunk;
+        }
+        encoder.finish(&streamed);
+        ASSERT_EQ(streamed, mime_text);
+        for (size_t i = 0; i < streamed.size();) {
+            auto chunk = std::min<size_t>(engine() % 100,
+                streamed.size() - i);
+            ASSERT_TRUE(decoder.update(streamed.substr(i, chunk), &restored));
+            i += chunk;
+        }
+        ASSERT_TRUE(decoder.finish(&restored));
+        ASSERT_EQ(restored, data);
+    }
+
+    /* padding is optional only when asked for */
+    std::string result;
+    EXPECT_FALSE(base64::decode("Zm9vYg", &result));
+    EXPECT_TRUE(base64::decode("Zm9vYg", &result, url));
+    EXPECT_EQ(result, "foob");
+    EXPECT_TRUE(base64::decode("Zm9vYg==", &result, url));
+    EXPECT_EQ(result, "foob");
+    EXPECT_FALSE(base64::decode("Zm9vY", &result, url));
+    EXPECT_FALSE(base64::decode("Zm9vYg=", &result, url));
+
+    /* each alphabet rejects the other's symbols */
+    EXPECT_TRUE(base64::decode("-_-_", &result, url));
+    EXPECT_EQ(result, "\xfb\xff\xbf");
+    EXPECT_FALSE(base64::decode("-_-_", &result));
+    EXPECT_FALSE(base64::decode("+/+/", &result, url));
+
+    /* line breaks are only skipped for wrapped text */
+    EXPECT_TRUE(base64::decode("Zm9v\r\nYmFy", &result, mime));
+    EXPECT_EQ(result, "foobar");
+    EXPECT_TRUE(base64::decode("Zm9\nvYmFy\n", &result, mime));
+    EXPECT_EQ(result, "foobar");
+    EXPECT_FALSE(base64::decode("Zm9v\r\nYmFy", &result));
+
+    base64::options pem;
+    pem.line_length = 64;
+    EXPECT_EQ(base64::encoded_size(48, pem), 64U);
+    EXPECT_EQ(base64::encoded_size(49, pem), 64U + 2 + 4);
+}
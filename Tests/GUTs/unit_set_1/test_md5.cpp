@@ -2,11 +2,33 @@
  * Created by TekuConcept on January 30, 2019
  */
 
+#include <random>
+#include <vector>
 #include <gtest/gtest.h>
 #include <rfc/md5.h>
+#include <utils/cpu_features.h>
 
 using namespace impact;
 
+namespace impact {
+    class test_md5_c {
+    public:
+        static std::string batch(const std::vector<std::string>& __messages,
+            internal::simd_level __level) {
+            std::vector<const void*> data;
+            std::vector<size_t> lengths;
+            for (const auto& message : __messages) {
+                data.push_back(message.data());
+                lengths.push_back(message.size());
+            }
+            std::string results(__messages.size() * md5::HASH_SIZE, '\0');
+            md5::_S_digest(data.data(), lengths.data(), __messages.size(),
+                (unsigned char*)&results[0], (int)__level);
+            return results;
+        }
+    };
+}
+
 TEST(test_md5, digest)
 {
     EXPECT_EQ(md5::digest(""), std::string(
@@ -61,3 +83,79 @@ TEST(test_md5, digest)
         "\x21\x07\xb6\x7a", 16)
     );
 }
+
+
+TEST(test_md5, incremental)
+{
+    std::string message;
+    for (int i = 0; i < 1000; i++) message.push_back((char)(i * 7 + i / 13));
+
+    /* every chunk size across block boundaries gives the one-shot digest */
+    for (size_t chunk = 1; chunk <= 130; chunk++) {
+        md5 hasher;
+        for (size_t i = 0; i < message.size(); i += chunk)
+            hasher.update(message.substr(i, chunk));
+        ASSERT_EQ(hasher.finalize(), md5::digest(message)) << chunk;
+    }
+
+    /* padding that spills into a second block */
+    for (size_t size = 50; size <= 70; size++) {
+        std::string text(size, 'x');
+        md5 hasher;
+        hasher.update(text.data(), 1);
+        hasher.update(text.data() + 1, size - 1);
+        ASSERT_EQ(hasher.finalize(), md5::digest(text)) << size;
+    }
+
+    /* finalize starts over, so the hasher can be reused */
+    md5 hasher;
+    hasher.update("message ", 8);
+    hasher.update(std::string("digest"));
+    unsigned char result[md5::HASH_SIZE];
+    hasher.finalize(result);
+    EXPECT_EQ(std::string((const char*)result, md5::HASH_SIZE),
+        std::string(
+        "\xf9\x6b\x69\x7d\x7c\xb7\x93\x8d"
+        "\x52\x5a\x2f\x31\xaa\xf1\x61\xd0"));
+    EXPECT_EQ(hasher.finalize(), md5::digest(""));
+
+    hasher.update("discarded", 9);
+    hasher.reset();
+    hasher.update(nullptr, 0);
+    EXPECT_EQ(hasher.finalize(), md5::digest(""));
+}
+
+
+TEST(test_md5, batch)
+{
+    using internal::simd_level;
+    std::mt19937 engine(2026);
+
+    /* lengths around the one and two block padding cases, in an
+       order that makes lanes finish at different times */
+    std::vector<std::string> messages;
+    for (int i = 0; i < 300; i++) {
+        std::string message(engine() % 200, '\0');
+        for (auto& c : message) c = (char)(engine() & 0xFF);
+        messages.push_back(message);
+    }
+    std::string expected;
+    for (const auto& message : messages) expected += md5::digest(message);
+
+    for (int l = 0; l < (int)simd_level::COUNT; l++) {
+        auto level = (simd_level)l;
+        if (!internal::simd_supported(level)) continue;
+        SCOPED_TRACE(internal::simd_name(level));
+        for (size_t count : { 0, 1, 3, 17, 300 }) {
+            std::vector<std::string> head(messages.begin(),
+                messages.begin() + count);
+            ASSERT_EQ(test_md5_c::batch(head, level),
+                expected.substr(0, count * md5::HASH_SIZE)) << count;
+        }
+    }
+
+    std::string results(messages.size() * md5::HASH_SIZE, '\0');
+    md5::digest(messages.data(), messages.size(),
+        (unsigned char*)&results[0]);
+    EXPECT_EQ(results, expected);
+}
@@ -0,0 +1,102 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <utils/metrics.h>
+
+using namespace impact;
+
+TEST(test_metrics, buckets) {
+    for (std::uint64_t value = 0; value < 16; value++)
+        EXPECT_EQ(histogram_snapshot::bucket_of(value), (size_t)value);
+
+    std::uint64_t samples[] = { 16, 17, 31, 32, 33, 1000, 123456789,
+        (std::uint64_t)1 << 40, ~(std::uint64_t)0 };
+    for (auto value : samples) {
+        auto index = histogram_snapshot::bucket_of(value);
+        ASSERT_LT(index, histogram_snapshot::k_buckets);
+        EXPECT_LE(histogram_snapshot::bucket_low(index), value);
+        EXPECT_GE(histogram_snapshot::bucket_high(index), value);
+        /* relative error stays under 1/16 */
+        auto width = histogram_snapshot::bucket_high(index) -
+            histogram_snapshot::bucket_low(index);
+        EXPECT_LE(width, value / 16);
+    }
+}
+
+
+#if !defined(IMPACT_NO_METRICS)
+
+TEST(test_metrics, counters) {
+    metrics::reset();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 1000; i++)
+                metrics::add(metric_counter::BYTES_SENT, 2);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    metrics::add(metric_counter::ACCEPTS);
+
+    auto snapshot = metrics::snapshot();
+    EXPECT_EQ(snapshot.counter(metric_counter::BYTES_SENT), 8000U);
+    EXPECT_EQ(snapshot.counter(metric_counter::ACCEPTS), 1U);
+    EXPECT_EQ(snapshot.counter(metric_counter::CONNECTS), 0U);
+
+    /* counts from finished threads survive in reused shards */
+    std::thread([]() { metrics::add(metric_counter::BYTES_SENT); }).join();
+    snapshot = metrics::snapshot();
+    EXPECT_EQ(snapshot.counter(metric_counter::BYTES_SENT), 8001U);
+}
+
+
+TEST(test_metrics, histograms) {
+    metrics::reset();
+    for (std::uint64_t value = 1; value <= 1000; value++)
+        metrics::record(metric_histogram::PIPELINE_LOOP, value * 1000);
+
+    auto snapshot  = metrics::snapshot();
+    auto histogram = snapshot.histogram(metric_histogram::PIPELINE_LOOP);
+    EXPECT_EQ(histogram.count, 1000U);
+    EXPECT_EQ(histogram.min, 1000U);
+    EXPECT_EQ(histogram.max, 1000000U);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 500500.0);
+
+    auto median = histogram.percentile(0.5);
+    EXPECT_GE(median, 500000U);
+    EXPECT_LE(median, 500000U + 500000U / 16);
+    auto tail = histogram.percentile(0.99);
+    EXPECT_GE(tail, 990000U);
+    EXPECT_LE(tail, 1000000U);
+    EXPECT_EQ(histogram.percentile(1.0), 1000000U);
+
+    EXPECT_EQ(snapshot.histogram(metric_histogram::STREAM_WAIT).count, 0U);
+    EXPECT_EQ(snapshot.histogram(metric_histogram::STREAM_WAIT).min, 0U);
+}
+
+
+TEST(test_metrics, prometheus) {
+    metrics::reset();
+    metrics::add(metric_counter::WOULD_BLOCK, 3);
+    {
+        metric_timer timer(metric_histogram::PIPELINE_CALLBACK);
+    }
+
+    auto text = metrics::prometheus();
+    EXPECT_NE(text.find("# TYPE impact_would_block_total counter\n"),
+        std::string::npos);
+    EXPECT_NE(text.find("impact_would_block_total 3\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE impact_pipeline_callback_seconds summary\n"),
+        std::string::npos);
+    EXPECT_NE(text.find("impact_pipeline_callback_seconds{quantile=\"0.99\"}"),
+        std::string::npos);
+    EXPECT_NE(text.find("impact_pipeline_callback_seconds_count 1\n"),
+        std::string::npos);
+}
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <vector>
+#include <thread>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <utils/mpsc_queue.h>
+
+using namespace impact;
+using namespace internal;
+
+namespace {
+    struct item : public mpsc_node {
+        int producer;
+        int value;
+    };
+}
+
+
+TEST(test_mpsc_queue, fifo) {
+    mpsc_queue queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.pop(), nullptr);
+
+    item items[3];
+    for (int i = 0; i < 3; i++) {
+        items[i].value = i;
+        queue.push(&items[i]);
+    }
+    EXPECT_FALSE(queue.empty());
+
+    for (int i = 0; i < 3; i++) {
+        auto node = static_cast<item*>(queue.pop());
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->value, i);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.pop(), nullptr);
+
+    /* nodes may be reused once popped */
+    queue.push(&items[1]);
+    EXPECT_EQ(queue.pop(), &items[1]);
+    EXPECT_TRUE(queue.empty());
+}
+
+
+TEST(test_mpsc_queue, multiple_producers) {
+    const int producers = 4;
+    const int count     = 5000;
+    mpsc_queue queue;
+    std::vector<std::unique_ptr<item[]>> storage;
+    for (int p = 0; p < producers; p++)
+        storage.emplace_back(new item[count]);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p](){
+            for (int i = 0; i < count; i++) {
+                storage[p][i].producer = p;
+                storage[p][i].value    = i;
+                queue.push(&storage[p][i]);
+            }
+        });
+    }
+
+    /* per-producer order must be preserved */
+    std::vector<int> next(producers, 0);
+    int received = 0;
+    while (received < producers * count) {
+        auto node = static_cast<item*>(queue.pop());
+        if (!node) continue;
+        EXPECT_EQ(node->value, next[node->producer]);
+        next[node->producer] = node->value + 1;
+        received++;
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_TRUE(queue.empty());
+}
@@ -2,11 +2,48 @@
  * Created by TekuConcept on July 28, 2017
  */
 
+#include <random>
+#include <vector>
 #include <gtest/gtest.h>
 #include <rfc/sha1.h>
+#include <utils/impact_error.h>
+#include <utils/cpu_features.h>
 
 using namespace impact;
 
+namespace impact {
+    class test_sha1_c {
+    public:
+        /* state after folding data into a state seeded from the engine */
+        static std::string blocks(const std::string& __data,
+            std::mt19937* __engine, internal::simd_level __level,
+            bool __sha_ni) {
+            sha1::context context;
+            sha1::_S_reset(&context);
+            for (auto& word : context.intermediate_hash) word = (*__engine)();
+            sha1::_S_process_blocks(&context,
+                (const unsigned char*)__data.data(), __data.size() / 64,
+                (int)__level, __sha_ni);
+            return std::string((const char*)context.intermediate_hash,
+                sizeof(context.intermediate_hash));
+        }
+
+        static std::string batch(const std::vector<std::string>& __messages,
+            internal::simd_level __level) {
+            std::vector<const void*> data;
+            std::vector<size_t> lengths;
+            for (const auto& message : __messages) {
+                data.push_back(message.data());
+                lengths.push_back(message.size());
+            }
+            std::string results(__messages.size() * sha1::HASH_SIZE, '\0');
+            sha1::_S_digest(data.data(), lengths.data(), __messages.size(),
+                (unsigned char*)&results[0], (int)__level);
+            return results;
+        }
+    };
+}
+
 TEST(test_sha1, digest)
 {
     std::string message = "hello world";
@@ -23,3 +60,146 @@ TEST(test_sha1, digest)
         "\x46\x06\xcf\x38\x59"
         "\x45\xb2\xbe\xc4\xea");
 }
+
+
+TEST(test_sha1, rfc3174_vectors)
+{
+    EXPECT_EQ(sha1::digest("abc"),
+        "\xa9\x99\x3e\x36\x47"
+        "\x06\x81\x6a\xba\x3e"
+        "\x25\x71\x78\x50\xc2"
+        "\x6c\x9c\xd0\xd8\x9d");
+
+    EXPECT_EQ(sha1::digest(
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+        "\x84\x98\x3e\x44\x1c"
+        "\x3b\xd2\x6e\xba\xae"
+        "\x4a\xa1\xf9\x51\x29"
+        "\xe5\xe5\x46\x70\xf1");
+
+    EXPECT_EQ(sha1::digest(std::string(1000000, 'a')),
+        "\x34\xaa\x97\x3c\xd4"
+        "\xc4\xda\xa4\xf6\x1e"
+        "\xeb\x2b\xdb\xad\x27"
+        "\x31\x65\x34\x01\x6f");
+
+    std::string repeated;
+    for (int i = 0; i < 10; i++)
+        repeated += "01234567012345670123456701234567"
+                    "01234567012345670123456701234567";
+    EXPECT_EQ(sha1::digest(repeated),
+        "\xde\xa3\x56\xa2\xcd"
+        "\xdd\x90\xc7\xa7\xec"
+        "\xed\xc5\xeb\xb5\x63"
+        "\x93\x4f\x46\x04\x52");
+
+    EXPECT_EQ(sha1::digest(""),
+        "\xda\x39\xa3\xee\x5e"
+        "\x6b\x4b\x0d\x32\x55"
+        "\xbf\xef\x95\x60\x18"
+        "\x90\xaf\xd8\x07\x09");
+}
+
+
+TEST(test_sha1, incremental)
+{
+    std::string message;
+    for (int i = 0; i < 1000; i++) message.push_back((char)(i * 7 + i / 13));
+
+    /* every chunk size across block boundaries gives the one-shot digest */
+    for (size_t chunk = 1; chunk <= 130; chunk++) {
+        sha1 hasher;
+        for (size_t i = 0; i < message.size(); i += chunk)
+            hasher.update(message.substr(i, chunk));
+        ASSERT_EQ(hasher.finalize(), sha1::digest(message)) << chunk;
+    }
+
+    /* finalize starts over, so the hasher can be reused */
+    sha1 hasher;
+    hasher.update("hello ", 6);
+    hasher.update(std::string("world"));
+    unsigned char result[sha1::HASH_SIZE];
+    hasher.finalize(result);
+    EXPECT_EQ(std::string((const char*)result, sha1::HASH_SIZE),
+        sha1::digest("hello world"));
+    hasher.update("abc", 3);
+    EXPECT_EQ(hasher.finalize(), sha1::digest("abc"));
+    EXPECT_EQ(hasher.finalize(), sha1::digest(""));
+
+    hasher.update("discarded", 9);
+    hasher.reset();
+    hasher.update(nullptr, 0);
+    EXPECT_EQ(hasher.finalize(), sha1::digest(""));
+}
+
+
+TEST(test_sha1, kernels)
+{
+    using test = test_sha1_c;
+    using internal::simd_level;
+    std::mt19937 engine(2026);
+
+    for (int l = 0; l < (int)simd_level::COUNT; l++) {
+    for (bool sha_ni : { false, true }) {
+        auto level = (simd_level)l;
+        if (!internal::simd_supported(level)) continue;
+        if (sha_ni && (level == simd_level::SCALAR ||
+            !internal::cpu().sha || !internal::cpu().sse41)) continue;
+        SCOPED_TRACE(internal::simd_name(level));
+        SCOPED_TRACE(sha_ni ? "sha" : "schedule");
+
+        /* odd and even block counts, from random states */
+        for (size_t blocks = 0; blocks <= 9; blocks++) {
+            std::string data(blocks * 64, '\0');
+            for (auto& c : data) c = (char)(engine() & 0xFF);
+            auto seed = engine();
+            std::mt19937 first(seed), second(seed);
+            ASSERT_EQ(test::blocks(data, &first, level, sha_ni),
+                test::blocks(data, &second, simd_level::SCALAR, false))
+                << blocks;
+        }
+    }}
+}
+
+
+TEST(test_sha1, batch)
+{
+    using internal::simd_level;
+    std::mt19937 engine(2026);
+
+    /* lengths around the one and two block padding cases, in an
+       order that makes lanes finish at different times */
+    std::vector<std::string> messages;
+    for (int i = 0; i < 300; i++) {
+        std::string message(engine() % 200, '\0');
+        for (auto& c : message) c = (char)(engine() & 0xFF);
+        messages.push_back(message);
+    }
+    std::string expected;
+    for (const auto& message : messages) expected += sha1::digest(message);
+
+    for (int l = 0; l < (int)simd_level::COUNT; l++) {
+        auto level = (simd_level)l;
+        if (!internal::simd_supported(level)) continue;
+        SCOPED_TRACE(internal::simd_name(level));
+        for (size_t count : { 0, 1, 3, 17, 300 }) {
+            std::vector<std::string> head(messages.begin(),
+                messages.begin() + count);
+            ASSERT_EQ(test_sha1_c::batch(head, level),
+                expected.substr(0, count * sha1::HASH_SIZE)) << count;
+        }
+    }
+
+    std::string results(messages.size() * sha1::HASH_SIZE, '\0');
+    sha1::digest(messages.data(), messages.size(),
+        (unsigned char*)&results[0]);
+    EXPECT_EQ(results, expected);
+
+    /* rejected before any message is read */
+    if (sizeof(size_t) > 4) {
+        const void* data[2] = { "abc", NULL };
+        size_t lengths[2]   = { 3, (size_t)-1 };
+        EXPECT_THROW(sha1::digest(data, lengths, 2,
+            (unsigned char*)&results[0]), impact_error);
+    }
+}
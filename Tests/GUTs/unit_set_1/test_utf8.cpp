@@ -4,9 +4,12 @@
 
 #include <vector>
 #include <string>
+#include <random>
 
 #include <gtest/gtest.h>
 #include <rfc/utf8.h>
+#include <utils/errno.h>
+#include <utils/cpu_features.h>
 
 namespace impact {
     class test_utf8_c {
@@ -17,6 +20,31 @@ namespace impact {
         static void encode(const char32_t& __symbol, std::string* __str) {
             utf8::_S_encode(__symbol, __str);
         }
+        static bool validate(const std::string& __input,
+            internal::simd_level __level, size_t* __symbols) {
+            return utf8::_S_validate(
+                (const unsigned char*)__input.data(), __input.size(),
+                (int)__level, __symbols);
+        }
+        template <typename T>
+        static bool serialize(const std::basic_string<T>& __input,
+            internal::simd_level __level, std::string* __result) {
+            /* the documented worst case, so overruns show up */
+            __result->assign(4 * __input.size() + 64, '\xAA');
+            size_t written;
+            bool valid = utf8::_S_serialize(__input.data(), __input.size(),
+                (unsigned char*)&(*__result)[0], &written, (int)__level);
+            __result->resize(written);
+            return valid;
+        }
+        template <typename T>
+        static void deserialize(const std::string& __input,
+            internal::simd_level __level, std::basic_string<T>* __result) {
+            __result->assign(__input.size() + 64, (T)0xAAAA);
+            __result->resize(utf8::_S_deserialize(
+                (const unsigned char*)__input.data(), __input.size(),
+                &(*__result)[0], (int)__level));
+        }
     };
 }
 
@@ -321,3 +349,209 @@ TEST(test_utf8, examples) {
     EXPECT_TRUE(utf8::deserialize(str4, &result));
     EXPECT_EQ(result, expected4);
 }
+
+
+TEST(test_utf8, validate) {
+    EXPECT_TRUE(utf8::validate(""));
+    EXPECT_TRUE(utf8::validate("\x41\xE2\x89\xA2\xCE\x91\x2E"));
+    EXPECT_TRUE(utf8::validate("\xED\x9F\xBF\xEE\x80\x80"));
+    EXPECT_TRUE(utf8::validate("\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"));
+
+    const struct { const char* text; imperr error; } bad[] = {
+        { "\xC0\xAF",             imperr::UTF8_BADSYM   }, /* overlong */
+        { "\xE0\x9F\xBF",         imperr::UTF8_BADSYM   },
+        { "\xF0\x8F\xBF\xBF",     imperr::UTF8_BADSYM   },
+        { "\xED\xA0\x80",         imperr::UTF8_BADSYM   }, /* surrogate */
+        { "\xF4\x90\x80\x80",     imperr::UTF8_BADSYM   }, /* > 10FFFF */
+        { "\xF5\x80\x80\x80",     imperr::UTF8_BADSYM   },
+        { "\xFF",                 imperr::UTF8_BADHEAD  },
+        { "a\x80",                imperr::UTF8_BADHEAD  }, /* stray tail */
+        { "\xE2\x89",             imperr::UTF8_BADTRAIL }, /* truncated */
+        { "\xE2\x89\x41",         imperr::UTF8_BADTRAIL }
+    };
+    for (const auto& test : bad) {
+        EXPECT_FALSE(utf8::validate(test.text)) << test.text;
+        EXPECT_EQ(imp_errno, test.error) << test.text;
+    }
+
+    /* deserialize rejects the same input and leaves the result alone */
+    std::u32string result(U"x");
+    EXPECT_FALSE(utf8::deserialize("\xED\xA0\x80", &result));
+    EXPECT_EQ(result, U"x");
+    EXPECT_FALSE(utf8::deserialize("\xC3", &result));
+    EXPECT_EQ(result, U"x");
+}
+
+
+TEST(test_utf8, validate_levels) {
+    using test = test_utf8_c;
+    std::mt19937 engine(7);
+    const char32_t samples[] = {
+        U'a', U'~', 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF,
+        0x10000, 0x10FFFF
+    };
+
+    for (int trial = 0; trial < 200; trial++) {
+        std::u32string text;
+        size_t count = engine() % 100;
+        bool ascii = engine() % 4 == 0;
+        for (size_t i = 0; i < count; i++)
+            text.push_back(ascii && engine() % 8 ? U'z' :
+                samples[engine() % 10]);
+        std::string input;
+        ASSERT_TRUE(utf8::serialize(text, &input));
+
+        /* every one-byte damage must be caught at every level */
+        for (int edit = 0; edit < 4; edit++) {
+            std::string damaged = input;
+            if (edit && !damaged.empty())
+                damaged[engine() % damaged.size()] = (char)engine();
+            size_t expected = 0;
+            bool valid = test::validate(damaged,
+                internal::simd_level::SCALAR, &expected);
+            auto error = imp_errno;
+            if (edit == 0) {
+                ASSERT_TRUE(valid);
+                ASSERT_EQ(expected, text.size());
+            }
+
+            for (int level = 1;
+                level < (int)internal::simd_level::COUNT; level++) {
+                auto simd = (internal::simd_level)level;
+                if (!internal::simd_supported(simd)) continue;
+                size_t symbols = 0;
+                ASSERT_EQ(test::validate(damaged, simd, &symbols), valid)
+                    << internal::simd_name(simd) << " trial " << trial;
+                EXPECT_EQ(imp_errno, error);
+                if (valid) {
+                    EXPECT_EQ(symbols, expected);
+                }
+            }
+
+            if (valid && edit == 0) {
+                std::u32string result;
+                ASSERT_TRUE(utf8::deserialize(damaged, &result));
+                EXPECT_EQ(result, text);
+            }
+        }
+    }
+}
+
+
+TEST(test_utf8, surrogate_pairs) {
+    /* U+10000, U+1F600 and U+10FFFF as UTF-16 */
+    std::u16string input(u"a\U00010000\U0001F600\U0010FFFF", 7);
+    std::string expected(
+        "a"
+        "\xF0\x90\x80\x80"
+        "\xF0\x9F\x98\x80"
+        "\xF4\x8F\xBF\xBF", 13);
+
+    std::string result;
+    EXPECT_TRUE(utf8::serialize(input, &result));
+    EXPECT_EQ(result, expected);
+
+    std::u16string decoded(u"x");
+    EXPECT_TRUE(utf8::deserialize_utf16(expected, &decoded));
+    EXPECT_EQ(decoded, u"x" + input);
+
+    /* unpaired, reversed or cut off halves */
+    const char16_t bad[][2] = {
+        { 0xD800, u'a' }, { 0xDC00, 0xD800 }, { 0xDBFF, 0xDBFF }
+    };
+    for (const auto& units : bad) {
+        result.assign("test");
+        EXPECT_FALSE(utf8::serialize(std::u16string(units, 2), &result));
+        EXPECT_EQ(imp_errno, imperr::UTF8_BADSYM);
+        EXPECT_EQ(result, "test");
+    }
+    EXPECT_FALSE(utf8::serialize(std::u16string(1, (char16_t)0xD800), NULL));
+}
+
+
+TEST(test_utf8, buffers) {
+    std::u16string text16(u"ab\u00E9\u4E2D\U0001F600", 6);
+    std::u32string text32(U"ab\u00E9\u4E2D\U0001F600", 5);
+    std::string expected(
+        "ab\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80", 11);
+
+    char bytes[32];
+    size_t written = 0;
+    EXPECT_TRUE(utf8::serialize(text16.data(), text16.size(), bytes,
+        &written));
+    EXPECT_EQ(std::string(bytes, written), expected);
+    EXPECT_TRUE(utf8::serialize(text32.data(), text32.size(), bytes,
+        &written));
+    EXPECT_EQ(std::string(bytes, written), expected);
+
+    char16_t units16[16];
+    char32_t units32[16];
+    EXPECT_TRUE(utf8::deserialize(expected.data(), expected.size(),
+        units16, &written));
+    EXPECT_EQ(std::u16string(units16, written), text16);
+    EXPECT_TRUE(utf8::deserialize(expected.data(), expected.size(),
+        units32, &written));
+    EXPECT_EQ(std::u32string(units32, written), text32);
+
+    /* serialize keeps the prefix; deserialize writes nothing */
+    text16[3] = 0xDC00;
+    EXPECT_FALSE(utf8::serialize(text16.data(), text16.size(), bytes,
+        &written));
+    EXPECT_EQ(std::string(bytes, written), expected.substr(0, 4));
+    EXPECT_FALSE(utf8::deserialize("ab\xC3", 3, units16, &written));
+    EXPECT_EQ(written, 0U);
+    EXPECT_EQ(imp_errno, imperr::UTF8_BADTRAIL);
+}
+
+
+TEST(test_utf8, transcode_levels) {
+    using test = test_utf8_c;
+    std::mt19937 engine(11);
+    const char32_t samples[] = {
+        0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF
+    };
+
+    for (int trial = 0; trial < 200; trial++) {
+        /* long ASCII runs around the odd wider symbol */
+        std::u32string text32;
+        size_t count = engine() % 300;
+        unsigned int odds = 1 + engine() % 64;
+        for (size_t i = 0; i < count; i++)
+            text32.push_back(engine() % odds ?
+                (char32_t)(0x20 + engine() % 0x5F) : samples[engine() % 8]);
+        std::string text8;
+        ASSERT_TRUE(utf8::serialize(text32, &text8));
+        std::u16string text16;
+        ASSERT_TRUE(utf8::deserialize_utf16(text8, &text16));
+
+        for (int level = 0; level < (int)internal::simd_level::COUNT;
+            level++) {
+            auto simd = (internal::simd_level)level;
+            if (!internal::simd_supported(simd)) continue;
+            std::string bytes;
+            std::u16string units16;
+            std::u32string units32;
+
+            EXPECT_TRUE(test::serialize(text16, simd, &bytes));
+            EXPECT_EQ(bytes, text8) << internal::simd_name(simd);
+            EXPECT_TRUE(test::serialize(text32, simd, &bytes));
+            EXPECT_EQ(bytes, text8) << internal::simd_name(simd);
+            test::deserialize(text8, simd, &units16);
+            EXPECT_EQ(units16, text16) << internal::simd_name(simd);
+            test::deserialize(text8, simd, &units32);
+            EXPECT_EQ(units32, text32) << internal::simd_name(simd);
+
+            /* a bad unit anywhere stops at the same place */
+            if (!text16.empty()) {
+                auto damaged = text16;
+                auto at = engine() % damaged.size();
+                damaged[at] = (char16_t)(0xDC00 + engine() % 0x400);
+                std::string expected;
+                bool valid = test::serialize(damaged,
+                    internal::simd_level::SCALAR, &expected);
+                EXPECT_EQ(test::serialize(damaged, simd, &bytes), valid);
+                EXPECT_EQ(bytes, expected);
+            }
+        }
+    }
+}
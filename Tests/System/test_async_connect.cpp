@@ -0,0 +1,91 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#include "sockets/async_connect.h"
+#include "sockets/async_pipeline.h"
+#include "test_helpers.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using basic_socket   = impact::basic_socket;
+using socket_error   = impact::socket_error;
+using async_pipeline = impact::internal::async_pipeline;
+
+
+void
+test_connect()
+{
+    VERBOSE("\nTest Connect");
+    auto server = impact::make_tcp_socket();
+    server.bind((int)0);
+    server.listen();
+
+    std::atomic<int> done(0);
+    basic_socket client;
+    /* 'localhost' may resolve to ::1 first; nothing listens there,
+       so the IPv4 candidate has to win the race */
+    impact::async_connect("localhost", server.local_port(),
+        std::chrono::milliseconds(2000),
+        [&](basic_socket __socket, socket_error __error) {
+            assert(async_pipeline::instance().in_pipeline());
+            assert(__error == socket_error::SUCCESS);
+            assert((bool)__socket);
+            client = __socket;
+            done++;
+        });
+    assert(wait_for(done, 1));
+
+    auto peer = server.accept();
+    client.send("ping", 4);
+    char buffer[4];
+    assert(peer.recv(buffer, 4) == 4);
+    peer.close();
+    client.close();
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_refused()
+{
+    VERBOSE("\nTest Refused");
+    /* grab a free port, then release it so nothing listens there */
+    auto probe = impact::make_tcp_socket();
+    probe.bind((int)0);
+    auto port = probe.local_port();
+    probe.close();
+
+    std::atomic<int> done(0);
+    auto start = std::chrono::steady_clock::now();
+    impact::async_connect("127.0.0.1", port,
+        std::chrono::milliseconds(2000),
+        [&](basic_socket __socket, socket_error __error) {
+            assert(!__socket);
+            assert(__error == socket_error::CONNECTION_REFUSED);
+            done++;
+        });
+    assert(wait_for(done, 1));
+    /* a refusal is final; it must not wait for the deadline */
+    assert(std::chrono::steady_clock::now() - start <
+        std::chrono::milliseconds(1000));
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_connect();
+    test_refused();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
@@ -1,8 +1,10 @@
 #include <iostream>
 #include <cassert>
+#include <vector>
 
 #include <basic_socket>
 #include <impact_error>
+#include "sockets/probe.h"
 
 #define VERBOSE(x) std::cout << x << std::endl
 
@@ -110,6 +112,92 @@ test_sigpipe()
 }
 
 
+void
+test_tuning()
+{
+    VERBOSE("\nTest Tuning Options");
+    basic_socket socket = make_tcp_socket();
+
+    VERBOSE("[1]");
+    socket.no_delay(true);
+    assert(socket.no_delay());
+    socket.no_delay(false);
+    assert(!socket.no_delay());
+
+    VERBOSE("[2]");
+    socket.send_buffer_size(64 * 1024);
+    assert(socket.send_buffer_size() >= 64 * 1024);
+    socket.receive_buffer_size(64 * 1024);
+    assert(socket.receive_buffer_size() >= 64 * 1024);
+
+#if defined(__OS_LINUX__)
+    VERBOSE("[3]");
+    socket.cork(true);
+    assert(socket.cork());
+    socket.cork(false);
+    socket.notsent_lowat(4096);
+    assert(socket.notsent_lowat() == 4096);
+    socket.quick_ack(true);
+    socket.priority(3);
+    assert(socket.priority() == 3);
+#endif
+
+    VERBOSE("[4]");
+    socket.latency_profile();
+    assert(socket.no_delay());
+    socket.throughput_profile();
+    assert(!socket.no_delay());
+
+    try { socket.close(); } catch (...) { assert(false); }
+    try {
+        socket.no_delay(true);
+        assert(false);
+    } catch (impact_error&) { }
+    VERBOSE("Done!");
+}
+
+
+void
+test_statistics()
+{
+    VERBOSE("\nTest Statistics");
+    basic_socket server = make_tcp_socket();
+    server.bind((int)0);
+    server.listen();
+    basic_socket client = make_tcp_socket();
+    client.connect(server.local_port(), "127.0.0.1");
+    basic_socket peer = server.accept();
+
+    VERBOSE("[1]");
+    assert(client.send("statistics", 10) == 10);
+    /* loopback delivery may be deferred past send(): wait for the
+       data to land, within a deadline */
+    std::vector<poll_handle> handles(1);
+    handles[0].socket = peer.get();
+    handles[0].events = (short)poll_flags::IN;
+    for (int i = 0; i < 100 && peer.receive_queue() != 10; i++)
+        poll(&handles, 10);
+    assert(peer.receive_queue() == 10);
+
+#if defined(__OS_LINUX__) || defined(__OS_APPLE__)
+    VERBOSE("[2]");
+    auto info = client.tcp_info();
+    assert(info.mss > 0);
+    assert(info.congestion_window > 0);
+    assert(client.send_queue() >= 0);
+#endif
+
+    char buffer[10];
+    assert(peer.recv(buffer, 10) == 10);
+    assert(peer.receive_queue() == 0);
+
+    peer.close();
+    client.close();
+    server.close();
+    VERBOSE("Done!");
+}
+
+
 int main() {
     VERBOSE("- BEGIN -");
 
@@ -117,6 +205,8 @@ int main() {
     test_create_constructor();
     test_close();
     test_sigpipe();
+    test_tuning();
+    test_statistics();
 
     VERBOSE("- END OF LINE -");
     return 0;
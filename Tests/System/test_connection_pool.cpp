@@ -0,0 +1,160 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+
+#include "utils/impact_error.h"
+#include "sockets/connection_pool.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using basic_socket    = impact::basic_socket;
+using connection_pool = impact::connection_pool;
+
+
+void
+test_reuse()
+{
+    VERBOSE("\nTest Reuse");
+    auto server = impact::make_tcp_socket();
+    server.bind((int)0);
+    server.listen();
+    auto port = server.local_port();
+
+    connection_pool pool;
+    auto first = pool.acquire("127.0.0.1", port);
+    auto descriptor = first.get();
+    assert(pool.active() == 1);
+    pool.release("127.0.0.1", port, first);
+    assert(pool.active() == 0);
+    assert(pool.idle() == 1);
+
+    /* a live socket survives the sweep and goes back to the pool */
+    pool.evict_idle();
+    assert(pool.idle() == 1);
+    assert(pool.active() == 0);
+
+    auto second = pool.acquire("127.0.0.1", port);
+    assert(second.get() == descriptor);
+    assert(pool.idle() == 0);
+    pool.release("127.0.0.1", port, second, false);
+    assert(pool.idle() == 0);
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_dead_connection()
+{
+    VERBOSE("\nTest Dead Connection");
+    auto server = impact::make_tcp_socket();
+    server.bind((int)0);
+    server.listen();
+    auto port = server.local_port();
+
+    connection_pool pool;
+    auto client = pool.acquire("127.0.0.1", port);
+    pool.release("127.0.0.1", port, client);
+
+    /* the peer hangs up while the connection sits idle */
+    auto peer = server.accept();
+    peer.close();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    pool.evict_idle();
+    assert(pool.idle() == 0);
+
+    client = pool.acquire("127.0.0.1", port);
+    auto fresh = server.accept();
+    assert(client.send("ok", 2) == 2);
+    char buffer[2];
+    assert(fresh.recv(buffer, 2) == 2);
+    pool.release("127.0.0.1", port, client);
+    fresh.close();
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_limits()
+{
+    VERBOSE("\nTest Limits");
+    auto server = impact::make_tcp_socket();
+    server.bind((int)0);
+    server.listen(16);
+    auto port = server.local_port();
+
+    connection_pool::options options;
+    options.max_idle  = 1;
+    options.max_total = 2;
+    connection_pool pool(options);
+
+    auto a = pool.acquire("127.0.0.1", port);
+    auto b = pool.acquire("127.0.0.1", port);
+    try {
+        pool.acquire("127.0.0.1", port);
+        assert(false);
+    }
+    catch (impact::impact_error&) { }
+
+    pool.release("127.0.0.1", port, a);
+    pool.release("127.0.0.1", port, b);
+    assert(pool.idle() == 1);
+    assert(pool.active() == 0);
+
+    /* an idle socket for another key is evicted to make room */
+    auto other = impact::make_tcp_socket();
+    other.bind((int)0);
+    other.listen();
+    auto c = pool.acquire("127.0.0.1", other.local_port());
+    auto d = pool.acquire("127.0.0.1", other.local_port());
+    assert(pool.idle() == 0);
+    assert(pool.active() == 2);
+    pool.release("127.0.0.1", other.local_port(), c, false);
+    pool.release("127.0.0.1", other.local_port(), d, false);
+
+    other.close();
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_idle_timeout()
+{
+    VERBOSE("\nTest Idle Timeout");
+    auto server = impact::make_tcp_socket();
+    server.bind((int)0);
+    server.listen();
+    auto port = server.local_port();
+
+    connection_pool::options options;
+    options.idle_timeout = std::chrono::milliseconds(20);
+    connection_pool pool(options);
+    pool.release("127.0.0.1", port, pool.acquire("127.0.0.1", port));
+    assert(pool.idle() == 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    pool.evict_idle();
+    assert(pool.idle() == 0);
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_reuse();
+    test_dead_connection();
+    test_limits();
+    test_idle_timeout();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
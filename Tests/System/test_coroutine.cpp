@@ -0,0 +1,144 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <string>
+
+#include "sockets/coroutine.h"
+#include "test_helpers.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using basic_socket   = impact::basic_socket;
+using async_task     = impact::async_task;
+using async_pipeline = impact::internal::async_pipeline;
+
+
+async_task
+echo_server(
+    basic_socket&     __listener,
+    std::atomic<int>& __done)
+{
+    auto peer = co_await impact::async_accept(__listener);
+    assert(async_pipeline::instance().in_pipeline());
+    peer.non_blocking(true);
+
+    char buffer[64];
+    int size;
+    while ((size = co_await impact::async_recv(peer, buffer, sizeof(buffer))) > 0)
+        co_await impact::async_send(peer, buffer, size);
+    peer.close();
+    __done++;
+}
+
+
+async_task
+echo_client(
+    unsigned short    __port,
+    std::atomic<int>& __done)
+{
+    auto client = impact::make_tcp_socket();
+    co_await impact::async_connect(client, __port);
+
+    std::string reply(4, '\0');
+    for (int i = 0; i < 3; i++) {
+        co_await impact::async_send(client, "ping", 4);
+        int received = 0;
+        while (received < 4)
+            received += co_await impact::async_recv(
+                client, &reply[received], 4 - received);
+        assert(reply == "ping");
+    }
+    client.close();
+    __done++;
+}
+
+
+async_task
+sleeper(std::atomic<int>& __done)
+{
+    auto start = std::chrono::steady_clock::now();
+    co_await impact::sleep_for(std::chrono::milliseconds(30));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(elapsed >= std::chrono::milliseconds(30));
+    assert(async_pipeline::instance().in_pipeline());
+    __done++;
+}
+
+
+async_task
+refused(
+    unsigned short    __port,
+    std::atomic<int>& __done)
+{
+    auto client = impact::make_tcp_socket();
+    try {
+        co_await impact::async_connect(client, __port);
+        assert(false);
+    }
+    catch (impact::impact_error&) { __done++; }
+    client.close();
+}
+
+
+void
+test_echo()
+{
+    VERBOSE("\nTest Echo");
+    std::atomic<int> done(0);
+    auto listener = impact::make_tcp_socket();
+    listener.bind((int)0);
+    listener.listen();
+
+    echo_server(listener, done);
+    echo_client(listener.local_port(), done);
+    assert(wait_for(done, 2));
+    listener.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_sleep()
+{
+    VERBOSE("\nTest Sleep");
+    std::atomic<int> done(0);
+    sleeper(done);
+    sleeper(done);
+    assert(wait_for(done, 2));
+    VERBOSE("Done!");
+}
+
+
+void
+test_connect_error()
+{
+    VERBOSE("\nTest Connect Error");
+    std::atomic<int> done(0);
+    /* grab a free port, then release it so nothing listens there */
+    auto probe = impact::make_tcp_socket();
+    probe.bind((int)0);
+    auto port = probe.local_port();
+    probe.close();
+
+    refused(port, done);
+    assert(wait_for(done, 1));
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_echo();
+    test_sleep();
+    test_connect_error();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
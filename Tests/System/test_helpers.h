@@ -0,0 +1,36 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#ifndef _IMPACT_TEST_HELPERS_H_
+#define _IMPACT_TEST_HELPERS_H_
+
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+/* Polls for up to five seconds while work finishes on another thread.
+   wait_for() wants the exact count; wait_for_at_least() tolerates
+   callbacks that may legitimately run again before the check. */
+
+inline bool
+wait_for_at_least(
+    const std::atomic<int>& __counter,
+    int                     __expected)
+{
+    for (int i = 0; i < 500 && __counter < __expected; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return __counter >= __expected;
+}
+
+
+inline bool
+wait_for(
+    const std::atomic<int>& __counter,
+    int                     __expected)
+{
+    wait_for_at_least(__counter, __expected);
+    return __counter == __expected;
+}
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <signal.h>
+
+#include "sockets/async_pipeline.h"
+#include "test_helpers.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using async_pipeline     = impact::internal::async_pipeline;
+using async_functor      = impact::internal::async_functor;
+using async_batch_object = impact::internal::async_batch_object;
+using async_option       = impact::internal::async_option;
+using ready_event        = impact::internal::ready_event;
+using poll_handle        = impact::poll_handle;
+using poll_flags         = impact::poll_flags;
+using socket_error       = impact::socket_error;
+
+
+class batch_reader : public async_batch_object {
+public:
+    std::atomic<int> calls;
+    std::atomic<int> events;
+    std::atomic<int> largest;
+
+    batch_reader() : calls(0), events(0), largest(0) {}
+
+    void on_ready(ready_event* __events, size_t __count) {
+        calls++;
+        if ((int)__count > largest) largest = (int)__count;
+        for (size_t i = 0; i < __count; i++) {
+            assert(__events[i].error == socket_error::SUCCESS);
+            char buffer[16];
+            auto size = ::recv(__events[i].handle->socket,
+                buffer, sizeof(buffer), 0);
+            /* the peer is closed on EOF: drop it from the pipeline */
+            if (size <= 0)
+                __events[i].option = async_option::QUIT;
+            else events++;
+        }
+    }
+};
+
+
+void
+test_batch_dispatch()
+{
+    VERBOSE("\nTest Batch Dispatch");
+    auto& pipeline = async_pipeline::instance();
+    auto reader    = std::make_shared<batch_reader>();
+
+    const int count = 8;
+    int pairs[count][2];
+    for (int i = 0; i < count; i++) {
+        assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, pairs[i]) == 0);
+        pipeline.add_object(pairs[i][0], reader);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    /* nothing is ready, so the batch object must not be called */
+    assert(reader->calls == 0);
+
+    for (int i = 0; i < count; i++)
+        assert(::send(pairs[i][1], "x", 1, 0) == 1);
+    assert(wait_for(reader->events, count));
+    VERBOSE("calls: " << reader->calls << ", largest: " << reader->largest);
+    assert(reader->calls <= count);
+
+    for (int i = 0; i < count; i++)
+        ::close(pairs[i][1]);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    for (int i = 0; i < count; i++)
+        ::close(pairs[i][0]);
+    VERBOSE("Done!");
+}
+
+
+void
+test_ready_only_dispatch()
+{
+    VERBOSE("\nTest Ready-Only Dispatch");
+    auto& pipeline = async_pipeline::instance();
+    pipeline.granularity(5);
+
+    int pair[2];
+    assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == 0);
+    std::atomic<int> calls(0);
+    pipeline.add_object(pair[0], std::make_shared<async_functor>(
+    [&](poll_handle* __handle, socket_error) -> async_option {
+        calls++;
+        if (__handle->return_events & (short)poll_flags::IN) {
+            char buffer[16];
+            if (::recv(__handle->socket, buffer, sizeof(buffer), 0) <= 0)
+                return async_option::QUIT;
+        }
+        return async_option::IGNORE;
+    }));
+
+    /* several granularity timeouts pass without a callback */
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    assert(calls == 0);
+
+    assert(::send(pair[1], "x", 1, 0) == 1);
+    assert(wait_for(calls, 1));
+
+    /* ignored until notify() re-arms it */
+    assert(::send(pair[1], "x", 1, 0) == 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    assert(calls == 1);
+    pipeline.notify();
+    assert(wait_for(calls, 2));
+
+    pipeline.remove_object(pair[0]);
+    pipeline.granularity(-1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ::close(pair[0]);
+    ::close(pair[1]);
+    VERBOSE("Done!");
+}
+
+
+void
+on_signal(int)
+{}
+
+
+void
+test_interrupted_notify()
+{
+    VERBOSE("\nTest Interrupted Notify");
+    auto& pipeline = async_pipeline::instance();
+    /* a long poll, so the signal lands while the thread waits in it */
+    pipeline.granularity(1000);
+
+    struct sigaction action;
+    ::memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    ::sigemptyset(&action.sa_mask);
+    assert(::sigaction(SIGUSR1, &action, NULL) == 0);
+
+    int pair[2];
+    assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == 0);
+    std::atomic<int> calls(0);
+    std::atomic<int> errors(0);
+    pthread_t loop = pthread_self();
+    pipeline.add_object(pair[0], std::make_shared<async_functor>(
+    [&](poll_handle* __handle, socket_error __error) -> async_option {
+        loop = pthread_self();
+        if (__error != socket_error::SUCCESS) errors++;
+        if (__handle->return_events & (short)poll_flags::IN) {
+            char buffer[16];
+            if (::recv(__handle->socket, buffer, sizeof(buffer), 0) <= 0)
+                return async_option::QUIT;
+        }
+        calls++;
+        return async_option::CONTINUE;
+    }));
+
+    assert(::send(pair[1], "x", 1, 0) == 1);
+    assert(wait_for(calls, 1));
+
+    /* EINTR with a notify() pending is dispatched as a plain tick */
+    for (int i = 2; i <= 5; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        pipeline.notify();
+        assert(::pthread_kill(loop, SIGUSR1) == 0);
+        assert(wait_for(calls, i));
+    }
+    assert(errors == 0);
+
+    pipeline.remove_object(pair[0]);
+    pipeline.granularity(-1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ::close(pair[0]);
+    ::close(pair[1]);
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_batch_dispatch();
+    test_ready_only_dispatch();
+    test_interrupted_notify();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "sockets/async_pipeline.h"
+#include "utils/metrics.h"
+#include "test_helpers.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using async_pipeline = impact::internal::async_pipeline;
+using async_object   = impact::internal::async_object;
+using async_option   = impact::internal::async_option;
+using slow_callback  = impact::internal::slow_callback;
+using poll_handle    = impact::poll_handle;
+using socket_error   = impact::socket_error;
+
+
+class sleepy_reader : public async_object {
+public:
+    std::atomic<int> calls;
+    int              delay;
+
+    explicit sleepy_reader(int __delay) : calls(0), delay(__delay) {}
+
+    async_option async_callback(poll_handle* __handle, socket_error) {
+        char buffer[16];
+        auto size = ::recv(__handle->socket, buffer, sizeof(buffer), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        calls++;
+        return size <= 0 ? async_option::QUIT : async_option::CONTINUE;
+    }
+};
+
+
+void
+test_slow_callback()
+{
+    VERBOSE("\nTest Slow Callback");
+    auto& pipeline = async_pipeline::instance();
+
+    std::mutex mtx;
+    std::atomic<int> reports(0);
+    int reported_socket = -2;
+    const std::type_info* reported_type = nullptr;
+    pipeline.slow_callback_threshold(std::chrono::milliseconds(20),
+        [&](const slow_callback& __report) {
+            std::lock_guard<std::mutex> lock(mtx);
+            reported_socket = __report.socket;
+            reported_type   = __report.type;
+            assert(__report.elapsed >= std::chrono::milliseconds(20));
+            reports++;
+        });
+
+    int fast[2], slow[2];
+    assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, fast) == 0);
+    assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, slow) == 0);
+    auto quick  = std::make_shared<sleepy_reader>(0);
+    auto sleepy = std::make_shared<sleepy_reader>(40);
+    pipeline.add_object(fast[0], quick);
+    pipeline.add_object(slow[0], sleepy);
+
+    assert(::send(fast[1], "a", 1, 0) == 1);
+    assert(wait_for_at_least(quick->calls, 1));
+    assert(reports == 0);
+
+    assert(::send(slow[1], "b", 1, 0) == 1);
+    assert(wait_for_at_least(sleepy->calls, 1));
+    assert(wait_for_at_least(reports, 1));
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        assert(reported_socket == slow[0]);
+        assert(*reported_type == typeid(sleepy_reader));
+    }
+
+    pipeline.slow_callback_threshold(std::chrono::nanoseconds(0));
+    ::close(fast[1]);
+    ::close(slow[1]);
+    assert(wait_for_at_least(quick->calls, 2));
+    assert(wait_for_at_least(sleepy->calls, 2));
+    assert(reports == 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ::close(fast[0]);
+    ::close(slow[0]);
+    VERBOSE("Done!");
+}
+
+
+class lag_timer : public impact::internal::async_timer {
+public:
+    std::atomic<int> fired;
+    lag_timer() : fired(0) {}
+    void on_timer() { fired++; }
+};
+
+
+void
+test_loop_metrics()
+{
+    VERBOSE("\nTest Loop Metrics");
+#if !defined(IMPACT_NO_METRICS)
+    auto& pipeline = async_pipeline::instance();
+    lag_timer timer;
+    pipeline.add_timer(&timer, async_pipeline::clock::now() +
+        std::chrono::milliseconds(10));
+    assert(wait_for_at_least(timer.fired, 1));
+
+    auto snapshot = impact::metrics::snapshot();
+    using histogram = impact::metric_histogram;
+    assert(snapshot.histogram(histogram::PIPELINE_LAG).count >= 1);
+    assert(snapshot.histogram(histogram::PIPELINE_POLL).count >= 1);
+    assert(snapshot.histogram(histogram::PIPELINE_LOOP).count >= 1);
+    assert(snapshot.histogram(histogram::PIPELINE_CALLBACK).count >= 1);
+    assert(snapshot.counter(impact::metric_counter::SLOW_CALLBACKS) >= 1);
+    VERBOSE(impact::metrics::prometheus());
+#endif
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_slow_callback();
+    test_loop_metrics();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
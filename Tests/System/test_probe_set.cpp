@@ -0,0 +1,142 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <chrono>
+
+#include <basic_socket>
+#include <impact_error>
+#include "sockets/probe.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using namespace impact;
+
+
+void
+test_empty_wait()
+{
+    VERBOSE("\nTest Empty Wait");
+    probe_set set;
+    std::vector<probe_event> ready;
+    assert(set.size() == 0);
+    assert(set.wait(&ready, 0) == 0);
+    assert(ready.size() == 0);
+    VERBOSE("Done!");
+}
+
+
+void
+test_ready_entries()
+{
+    VERBOSE("\nTest Ready Entries");
+    basic_socket server = make_tcp_socket();
+    server.bind(0);
+    server.listen();
+
+    basic_socket client = make_tcp_socket();
+    client.connect(server.local_port());
+    basic_socket peer = server.accept();
+
+    int tag_client = 1, tag_server = 2;
+    probe_set set;
+    std::vector<probe_event> ready;
+
+    VERBOSE("[1]");
+    set.add(client.get(), (short)poll_flags::IN, &tag_client);
+    set.add(server.get(), (short)poll_flags::IN, &tag_server);
+    assert(set.size() == 2);
+    assert(set.contains(client.get()));
+    assert(set.wait(&ready, 0) == 0);
+
+    VERBOSE("[2]");
+    peer.send("ping", 4);
+    assert(set.wait(&ready, 1000) == 1);
+    assert(ready.size() == 1);
+    assert(ready[0].socket == client.get());
+    assert(ready[0].data == &tag_client);
+    assert(ready[0].return_events & (short)poll_flags::IN);
+
+    VERBOSE("[3]");
+    set.modify(client.get(), (short)poll_flags::OUT, &tag_server);
+    assert(set.wait(&ready, 1000) == 1);
+    assert(ready[0].data == &tag_server);
+    assert(ready[0].return_events & (short)poll_flags::OUT);
+
+    VERBOSE("[4]");
+    set.remove(client.get());
+    assert(!set.contains(client.get()));
+    assert(set.wait(&ready, 0) == 0);
+    try {
+        set.remove(client.get());
+        assert(false);
+    } catch (impact_error&) { }
+
+    client.close();
+    peer.close();
+    server.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_high_resolution_timeout()
+{
+    VERBOSE("\nTest High Resolution Timeout");
+    using clock = std::chrono::steady_clock;
+    basic_socket socket = make_udp_socket();
+    socket.bind(0);
+
+    probe_set set;
+    std::vector<probe_event> ready;
+    set.add(socket.get(), (short)poll_flags::IN);
+
+    VERBOSE("[1]");
+    auto start  = clock::now();
+    auto status = set.wait(&ready, std::chrono::microseconds(200));
+    auto spent  = clock::now() - start;
+    assert(status == 0);
+    assert(spent >= std::chrono::microseconds(200));
+    VERBOSE("probe_set waited " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(spent).count()
+        << "us");
+
+    VERBOSE("[2]");
+    std::vector<poll_handle> handles(1);
+    handles[0].socket = socket.get();
+    handles[0].events = (short)poll_flags::IN;
+    start  = clock::now();
+    status = poll(&handles, std::chrono::microseconds(200));
+    spent  = clock::now() - start;
+    assert(status == 0);
+    VERBOSE("poll waited " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(spent).count()
+        << "us");
+
+    VERBOSE("[3]");
+    std::vector<basic_socket*> readers{ &socket }, writers;
+    status = select(readers, writers, std::chrono::microseconds(200));
+    assert(status == 0);
+
+    VERBOSE("[4]");
+    try { socket.busy_poll(50); }
+    catch (impact_error& e) { VERBOSE("busy_poll: " << e.message()); }
+
+    socket.close();
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_empty_wait();
+    test_ready_entries();
+    test_high_resolution_timeout();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#include "utils/thread_pool.h"
+#include "sockets/async_pipeline.h"
+#include "test_helpers.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using thread_pool    = impact::internal::thread_pool;
+using async_pipeline = impact::internal::async_pipeline;
+
+
+void
+test_external_submit()
+{
+    VERBOSE("\nTest External Submit");
+    std::atomic<int> counter(0);
+    thread_pool::options options;
+    options.threads = 4;
+    thread_pool pool(options);
+    assert(pool.size() == 4);
+    assert(!pool.in_pool());
+
+    for (int i = 0; i < 10000; i++)
+        pool.submit([&](){ counter++; });
+    assert(wait_for(counter, 10000));
+    VERBOSE("Done!");
+}
+
+
+void
+test_nested_submit()
+{
+    VERBOSE("\nTest Nested Submit (Work Stealing)");
+    std::atomic<int> counter(0);
+    thread_pool::options options;
+    options.threads     = 3;
+    options.pin_threads = true;
+    thread_pool pool(options);
+
+    for (int i = 0; i < 10; i++) {
+        pool.submit([&](){
+            assert(pool.in_pool());
+            /* overflow the local deque so it has to grow */
+            for (int j = 0; j < 200; j++)
+                pool.submit([&](){ counter++; });
+        });
+    }
+    assert(wait_for(counter, 2000));
+    VERBOSE("Done!");
+}
+
+
+void
+test_drain_on_destroy()
+{
+    VERBOSE("\nTest Drain On Destroy");
+    std::atomic<int> counter(0);
+    {
+        thread_pool::options options;
+        options.threads = 2;
+        thread_pool pool(options);
+        for (int i = 0; i < 1000; i++)
+            pool.submit([&](){ counter++; });
+    }
+    assert(counter == 1000);
+    VERBOSE("Done!");
+}
+
+
+void
+test_pipeline_offload()
+{
+    VERBOSE("\nTest Pipeline Offload");
+    std::atomic<int> counter(0);
+    auto& pipeline = async_pipeline::instance();
+    thread_pool::options options;
+    options.threads = 2;
+    pipeline.pool_options(options);
+    for (int i = 0; i < 100; i++)
+        pipeline.offload([&](){ counter++; });
+    assert(wait_for(counter, 100));
+    try {
+        pipeline.pool_options(options);
+        assert(false);
+    } catch (...) { }
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_external_submit();
+    test_nested_submit();
+    test_drain_on_destroy();
+    test_pipeline_offload();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * Created by TekuConcept on October 19, 2026
+ */
+
+#include <iostream>
+#include <cassert>
+#include <utility>
+
+#include "utils/impact_error.h"
+#include "sockets/unique_socket.h"
+
+#define VERBOSE(x) std::cout << x << std::endl
+
+using unique_socket = impact::unique_socket;
+using basic_socket  = impact::basic_socket;
+
+
+void
+test_layout()
+{
+    VERBOSE("\nTest Layout");
+    static_assert(sizeof(unique_socket) == 2 * sizeof(int),
+        "descriptor plus packed traits");
+    auto socket = impact::make_unique_tcp_socket();
+    assert((bool)socket);
+    assert(socket.domain()   == impact::address_family::INET);
+    assert(socket.type()     == impact::socket_type::STREAM);
+    assert(socket.protocol() == impact::internet_protocol::TCP);
+    VERBOSE("Done!");
+}
+
+
+void
+test_move()
+{
+    VERBOSE("\nTest Move");
+    auto first = impact::make_unique_udp_socket();
+    auto descriptor = first.get();
+    unique_socket second(std::move(first));
+    assert(!first);
+    assert(second.get() == descriptor);
+
+    unique_socket third;
+    third = std::move(second);
+    assert(!second);
+    assert(third.get() == descriptor);
+    assert(third.type() == impact::socket_type::DATAGRAM);
+
+    auto raw = third.release();
+    assert(!third);
+    auto adopted = impact::adopt_unique_socket(raw,
+        impact::address_family::INET, impact::socket_type::DATAGRAM,
+        impact::internet_protocol::UDP);
+    assert(adopted.get() == descriptor);
+    VERBOSE("Done!");
+}
+
+
+void
+test_share()
+{
+    VERBOSE("\nTest Accept And Share");
+    auto listener = impact::make_tcp_socket();
+    listener.bind((int)0);
+    listener.listen();
+
+    auto client = impact::make_unique_tcp_socket();
+    client.connect(listener.local_port());
+    auto peer = listener.accept();
+
+    assert(client.send("ping", 4) == 4);
+    char buffer[4];
+    assert(peer.recv(buffer, 4) == 4);
+
+    basic_socket shared = client.share();
+    assert(!client);
+    assert(shared.domain() == impact::address_family::INET);
+    assert(shared.send("pong", 4) == 4);
+    assert(peer.recv(buffer, 4) == 4);
+
+    try {
+        client.share();
+        assert(false);
+    }
+    catch (impact::impact_error&) { }
+
+    peer.close();
+    shared.close();
+    listener.close();
+    VERBOSE("Done!");
+}
+
+
+void
+test_accept()
+{
+    VERBOSE("\nTest Unique Accept");
+    auto listener = impact::make_unique_tcp_socket();
+    listener.bind((unsigned short)0);
+    listener.listen();
+
+    auto client = impact::make_unique_tcp_socket();
+    client.connect(listener.local_port());
+    auto peer = listener.accept();
+    assert(peer.protocol() == impact::internet_protocol::TCP);
+
+    assert(client.send("ping", 4) == 4);
+    char buffer[4];
+    assert(peer.recv(buffer, 4) == 4);
+    peer.shutdown();
+    assert(client.recv(buffer, 4) == 0);
+    VERBOSE("Done!");
+}
+
+
+int main() {
+    VERBOSE("- BEGIN -");
+
+    test_layout();
+    test_move();
+    test_share();
+    test_accept();
+
+    VERBOSE("- END OF LINE -");
+    return 0;
+}
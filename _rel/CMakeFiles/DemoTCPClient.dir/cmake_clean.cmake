@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DemoTCPClient.dir/Examples/DemoTCPClient.cpp.o"
+  "CMakeFiles/DemoTCPClient.dir/Examples/DemoTCPClient.cpp.o.d"
+  "DemoTCPClient"
+  "DemoTCPClient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DemoTCPClient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DemoTCPServer.dir/Examples/DemoTCPServer.cpp.o"
+  "CMakeFiles/DemoTCPServer.dir/Examples/DemoTCPServer.cpp.o.d"
+  "DemoTCPServer"
+  "DemoTCPServer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DemoTCPServer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
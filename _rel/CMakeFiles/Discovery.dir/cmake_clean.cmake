@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Discovery.dir/Examples/Discovery.cpp.o"
+  "CMakeFiles/Discovery.dir/Examples/Discovery.cpp.o.d"
+  "Discovery"
+  "Discovery.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Discovery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EthernetDemo.dir/Examples/EthernetDemo.cpp.o"
+  "CMakeFiles/EthernetDemo.dir/Examples/EthernetDemo.cpp.o.d"
+  "EthernetDemo"
+  "EthernetDemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EthernetDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Sockets/Source/async_connect.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_connect.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_connect.cpp.o.d"
+  "/root/repo/Sockets/Source/async_pipeline.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_pipeline.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_pipeline.cpp.o.d"
+  "/root/repo/Sockets/Source/basic_socket.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket.cpp.o.d"
+  "/root/repo/Sockets/Source/basic_socket_delivery.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_delivery.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_delivery.cpp.o.d"
+  "/root/repo/Sockets/Source/basic_socket_misc.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_misc.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_misc.cpp.o.d"
+  "/root/repo/Sockets/Source/connection_pool.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/connection_pool.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/connection_pool.cpp.o.d"
+  "/root/repo/Sockets/Source/generic.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/generic.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/generic.cpp.o.d"
+  "/root/repo/Sockets/Source/networking.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/networking.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/networking.cpp.o.d"
+  "/root/repo/Sockets/Source/nonblocking.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/nonblocking.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/nonblocking.cpp.o.d"
+  "/root/repo/Sockets/Source/probe.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/probe.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/probe.cpp.o.d"
+  "/root/repo/Sockets/Source/raw_socket.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/raw_socket.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/raw_socket.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/base64.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/base64_simd.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64_simd.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64_simd.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/hash_lanes.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/hash_lanes.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/hash_lanes.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/md5.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/md5.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/md5.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/sha1.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/sha1_simd.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1_simd.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1_simd.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/uri.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/uri.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/uri.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/utf8.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8.cpp.o.d"
+  "/root/repo/Sockets/Source/rfc/utf8_simd.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8_simd.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8_simd.cpp.o.d"
+  "/root/repo/Sockets/Source/socketstream.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/socketstream.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/socketstream.cpp.o.d"
+  "/root/repo/Sockets/Source/unique_socket.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/unique_socket.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/unique_socket.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/cpu_features.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/cpu_features.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/cpu_features.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/errno.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/errno.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/errno.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/impact_error.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/impact_error.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/impact_error.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/metrics.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/metrics.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/metrics.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/thread_pool.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/thread_pool.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/thread_pool.cpp.o.d"
+  "/root/repo/Sockets/Source/utils/worker_thread.cpp" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/worker_thread.cpp.o" "gcc" "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/worker_thread.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_connect.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_connect.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_pipeline.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/async_pipeline.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_delivery.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_delivery.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_misc.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/basic_socket_misc.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/connection_pool.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/connection_pool.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/generic.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/generic.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/networking.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/networking.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/nonblocking.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/nonblocking.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/probe.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/probe.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/raw_socket.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/raw_socket.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64_simd.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/base64_simd.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/hash_lanes.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/hash_lanes.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/md5.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/md5.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1_simd.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/sha1_simd.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/uri.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/uri.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8_simd.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/rfc/utf8_simd.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/socketstream.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/socketstream.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/unique_socket.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/unique_socket.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/cpu_features.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/cpu_features.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/errno.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/errno.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/impact_error.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/impact_error.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/metrics.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/metrics.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/thread_pool.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/thread_pool.cpp.o.d"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/worker_thread.cpp.o"
+  "CMakeFiles/ImpactSockets_obj.dir/Sockets/Source/utils/worker_thread.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ImpactSockets_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
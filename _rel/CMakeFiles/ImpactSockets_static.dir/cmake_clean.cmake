@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libImpactSockets.a"
+  "libImpactSockets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ImpactSockets_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
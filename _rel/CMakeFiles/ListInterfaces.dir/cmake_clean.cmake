@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ListInterfaces.dir/Examples/ListInterfaces.cpp.o"
+  "CMakeFiles/ListInterfaces.dir/Examples/ListInterfaces.cpp.o.d"
+  "ListInterfaces"
+  "ListInterfaces.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ListInterfaces.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
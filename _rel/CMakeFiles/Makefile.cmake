@@ -0,0 +1,102 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMake/Checks.cmake"
+  "/root/repo/CMake/Configuration.cmake"
+  "/root/repo/CMake/Dependencies.cmake"
+  "/root/repo/CMake/Functions.cmake"
+  "/root/repo/CMake/configure.h.in"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "utils/configure.h"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/ImpactSockets_obj.dir/DependInfo.cmake"
+  "CMakeFiles/ImpactSockets_static.dir/DependInfo.cmake"
+  "CMakeFiles/DemoTCPClient.dir/DependInfo.cmake"
+  "CMakeFiles/DemoTCPServer.dir/DependInfo.cmake"
+  "CMakeFiles/Discovery.dir/DependInfo.cmake"
+  "CMakeFiles/ListInterfaces.dir/DependInfo.cmake"
+  "CMakeFiles/EthernetDemo.dir/DependInfo.cmake"
+  "CMakeFiles/unit_set_1.dir/DependInfo.cmake"
+  "CMakeFiles/test_basic_socket.dir/DependInfo.cmake"
+  "CMakeFiles/test_networking.dir/DependInfo.cmake"
+  "CMakeFiles/test_impact_error.dir/DependInfo.cmake"
+  "CMakeFiles/test_worker_thread.dir/DependInfo.cmake"
+  "CMakeFiles/test_async_pipeline.dir/DependInfo.cmake"
+  "CMakeFiles/test_probe_set.dir/DependInfo.cmake"
+  "CMakeFiles/test_thread_pool.dir/DependInfo.cmake"
+  "CMakeFiles/test_pipeline_batch.dir/DependInfo.cmake"
+  "CMakeFiles/test_async_connect.dir/DependInfo.cmake"
+  "CMakeFiles/test_connection_pool.dir/DependInfo.cmake"
+  "CMakeFiles/test_unique_socket.dir/DependInfo.cmake"
+  "CMakeFiles/test_pipeline_profile.dir/DependInfo.cmake"
+  "CMakeFiles/test_coroutine.dir/DependInfo.cmake"
+  "CMakeFiles/bench_tcp_latency.dir/DependInfo.cmake"
+  "CMakeFiles/bench_tcp_throughput.dir/DependInfo.cmake"
+  "CMakeFiles/bench_udp_pps.dir/DependInfo.cmake"
+  "CMakeFiles/bench_accept_rate.dir/DependInfo.cmake"
+  "CMakeFiles/bench_pipeline_scaling.dir/DependInfo.cmake"
+  "CMakeFiles/bench_rfc_codecs.dir/DependInfo.cmake"
+  "CMakeFiles/run_benchmarks.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_accept_rate.dir/Benchmarks/bench_accept_rate.cpp.o"
+  "CMakeFiles/bench_accept_rate.dir/Benchmarks/bench_accept_rate.cpp.o.d"
+  "bench_accept_rate"
+  "bench_accept_rate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_accept_rate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
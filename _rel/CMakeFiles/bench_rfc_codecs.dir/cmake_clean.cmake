@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_rfc_codecs.dir/Benchmarks/bench_rfc_codecs.cpp.o"
+  "CMakeFiles/bench_rfc_codecs.dir/Benchmarks/bench_rfc_codecs.cpp.o.d"
+  "bench_rfc_codecs"
+  "bench_rfc_codecs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_rfc_codecs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
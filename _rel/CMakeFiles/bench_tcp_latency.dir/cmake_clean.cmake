@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_tcp_latency.dir/Benchmarks/bench_tcp_latency.cpp.o"
+  "CMakeFiles/bench_tcp_latency.dir/Benchmarks/bench_tcp_latency.cpp.o.d"
+  "bench_tcp_latency"
+  "bench_tcp_latency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_tcp_latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
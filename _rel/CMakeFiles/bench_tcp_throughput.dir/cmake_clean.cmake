@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_tcp_throughput.dir/Benchmarks/bench_tcp_throughput.cpp.o"
+  "CMakeFiles/bench_tcp_throughput.dir/Benchmarks/bench_tcp_throughput.cpp.o.d"
+  "bench_tcp_throughput"
+  "bench_tcp_throughput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_tcp_throughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_udp_pps.dir/Benchmarks/bench_udp_pps.cpp.o"
+  "CMakeFiles/bench_udp_pps.dir/Benchmarks/bench_udp_pps.cpp.o.d"
+  "bench_udp_pps"
+  "bench_udp_pps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_udp_pps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_async_connect.dir/Tests/System/test_async_connect.cpp.o"
+  "CMakeFiles/test_async_connect.dir/Tests/System/test_async_connect.cpp.o.d"
+  "test_async_connect"
+  "test_async_connect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_async_connect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
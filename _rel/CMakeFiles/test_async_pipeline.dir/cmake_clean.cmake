@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_async_pipeline.dir/Tests/System/test_async_pipeline.cpp.o"
+  "CMakeFiles/test_async_pipeline.dir/Tests/System/test_async_pipeline.cpp.o.d"
+  "test_async_pipeline"
+  "test_async_pipeline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_async_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_basic_socket.dir/Tests/System/test_basic_socket.cpp.o"
+  "CMakeFiles/test_basic_socket.dir/Tests/System/test_basic_socket.cpp.o.d"
+  "test_basic_socket"
+  "test_basic_socket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_basic_socket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
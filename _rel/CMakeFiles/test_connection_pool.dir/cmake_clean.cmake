@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_connection_pool.dir/Tests/System/test_connection_pool.cpp.o"
+  "CMakeFiles/test_connection_pool.dir/Tests/System/test_connection_pool.cpp.o.d"
+  "test_connection_pool"
+  "test_connection_pool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_connection_pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
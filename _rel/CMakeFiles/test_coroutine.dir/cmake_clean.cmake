@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coroutine.dir/Tests/System/test_coroutine.cpp.o"
+  "CMakeFiles/test_coroutine.dir/Tests/System/test_coroutine.cpp.o.d"
+  "test_coroutine"
+  "test_coroutine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coroutine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_impact_error.dir/Tests/System/test_impact_error.cpp.o"
+  "CMakeFiles/test_impact_error.dir/Tests/System/test_impact_error.cpp.o.d"
+  "test_impact_error"
+  "test_impact_error.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_impact_error.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
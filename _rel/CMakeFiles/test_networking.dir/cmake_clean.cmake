@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_networking.dir/Tests/System/test_networking.cpp.o"
+  "CMakeFiles/test_networking.dir/Tests/System/test_networking.cpp.o.d"
+  "test_networking"
+  "test_networking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_networking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pipeline_batch.dir/Tests/System/test_pipeline_batch.cpp.o"
+  "CMakeFiles/test_pipeline_batch.dir/Tests/System/test_pipeline_batch.cpp.o.d"
+  "test_pipeline_batch"
+  "test_pipeline_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pipeline_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
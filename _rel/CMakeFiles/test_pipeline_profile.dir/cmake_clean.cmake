@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pipeline_profile.dir/Tests/System/test_pipeline_profile.cpp.o"
+  "CMakeFiles/test_pipeline_profile.dir/Tests/System/test_pipeline_profile.cpp.o.d"
+  "test_pipeline_profile"
+  "test_pipeline_profile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pipeline_profile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
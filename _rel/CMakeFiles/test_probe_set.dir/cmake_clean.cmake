@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_probe_set.dir/Tests/System/test_probe_set.cpp.o"
+  "CMakeFiles/test_probe_set.dir/Tests/System/test_probe_set.cpp.o.d"
+  "test_probe_set"
+  "test_probe_set.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_probe_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unique_socket.dir/Tests/System/test_unique_socket.cpp.o"
+  "CMakeFiles/test_unique_socket.dir/Tests/System/test_unique_socket.cpp.o.d"
+  "test_unique_socket"
+  "test_unique_socket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unique_socket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
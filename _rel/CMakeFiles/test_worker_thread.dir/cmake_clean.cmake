@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_worker_thread.dir/Tests/System/test_worker_thread.cpp.o"
+  "CMakeFiles/test_worker_thread.dir/Tests/System/test_worker_thread.cpp.o.d"
+  "test_worker_thread"
+  "test_worker_thread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_worker_thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
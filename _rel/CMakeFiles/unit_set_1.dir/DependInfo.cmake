@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/GUTs/main.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/main.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/main.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_abnf_ops.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_abnf_ops.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_abnf_ops.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_base64.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_base64.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_base64.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_bit_ops.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_bit_ops.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_bit_ops.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_md5.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_md5.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_md5.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_metrics.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_metrics.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_metrics.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_mpsc_queue.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_mpsc_queue.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_mpsc_queue.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_sha1.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_sha1.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_sha1.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_uri.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_uri.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_uri.cpp.o.d"
+  "/root/repo/Tests/GUTs/unit_set_1/test_utf8.cpp" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_utf8.cpp.o" "gcc" "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_utf8.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/CMakeFiles/ImpactSockets_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
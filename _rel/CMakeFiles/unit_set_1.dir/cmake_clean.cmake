@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/main.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/main.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_abnf_ops.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_abnf_ops.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_base64.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_base64.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_bit_ops.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_bit_ops.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_md5.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_md5.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_metrics.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_metrics.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_mpsc_queue.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_mpsc_queue.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_sha1.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_sha1.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_uri.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_uri.cpp.o.d"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_utf8.cpp.o"
+  "CMakeFiles/unit_set_1.dir/Tests/GUTs/unit_set_1/test_utf8.cpp.o.d"
+  "unit_set_1"
+  "unit_set_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_set_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+#ifndef _IMPACT_CONFIGURE_H_
+#define _IMPACT_CONFIGURE_H_
+
+/* #undef __OS_APPLE__ */
+#define __OS_LINUX__
+/* #undef __OS_WINDOWS__ */
+/* not tested on unix or solaris systems */
+
+/* #undef BIG_ENDIAN */
+#define LITTLE_ENDIAN
+
+#define HAVE_FALLTHROUGH_ATTRIBUTE /* C++17 feature: [[fallthrough]] */
+#define HAVE_EPOLL                 /* linux: epoll_create1(), epoll_wait() */
+#define HAVE_EPOLL_PWAIT2          /* linux 5.11, glibc 2.35: epoll_pwait2() */
+#define HAVE_X86_SIMD              /* x86 intrinsics with per-function target attributes */
+
+#define HAVE_UINT8_T
+#define HAVE_UINT16_T
+#define HAVE_UINT32_T
+#define HAVE_UINT64_T
+#define HAVE_INT8_T
+#define HAVE_INT16_T
+#define HAVE_INT32_T
+#define HAVE_INT64_T
+
+/* #undef HAVE_NPCAP */
+
+/* #undef IMPACT_NO_METRICS */
+
+#endif